@@ -5,177 +5,211 @@
 */
 
 #include "AStar.h"
-#include "Interface.h"
+#include <algorithm>
+#include <cstdlib>
+#include "PhaseTracer.h"
 using namespace std;
 
 /**
 * Finds the shortest path(s) from starting to destination locations based on map type.
 * @return result:The shortest path
 */
-pair<vector<pair<int, int>>, vector<pair<int, int>>> AStar::runAlgorithm() {
-   vector<vector<Block*>> shortestPath;
-   vector<Block*> pathInstance;
-   //get start and end points
-   Block* startBlock = currentBoard->getMap()->getStartPoint();
-   Block* targetBlock = currentBoard->getMap()->getTargetPoint();
-   pair<vector<pair<int, int>>, vector<pair<int, int>>> result = findShortestPathOnMap(startBlock, targetBlock);
-   return result;
+const pair<vector<pair<int, int>>, vector<pair<int, int>>>& AStar::runAlgorithm() {
+   LevelMap& map = *currentBoard->getMap();
+   const GraphView& graph = map.getGraph();
+   const ChainGraph& chains = map.getChains();
+   // the search only reads the graphs of the map, its state is in the workspace of the thread
+   SearchWorkspace& workspace = SearchWorkspace::local();
+   ChainQuery& query = workspace.query;
+   query.startNodes.clear();
+   query.targetNodes.clear();
+   //get start and end points, there is no route from or to a wall
+   pair<int, int> startBlock = map.getStartPoint();
+   pair<int, int> targetBlock = map.getTargetPoint();
+   int startNode = graph.getNode(startBlock.first, startBlock.second);
+   int targetNode = graph.getNode(targetBlock.first, targetBlock.second);
+   if(startNode >= 0 && targetNode >= 0) {
+       query.startNodes.push_back(startNode);
+       query.targetNodes.push_back(targetNode);
+   }
+   findShortestPathOnMap(graph, chains, workspace, 1);
+   // walking back the path and building the result vectors is timed apart from the search
+   TraceSpan span(PHASE_RESULT, currentBoard->getMapType());
+   if(!workspace.reached.empty()) {
+       chains.appendPath(graph, query, workspace.state, workspace.reached[0], workspace.result.second);
+   }
+   return workspace.result;
 }
 
 /**
- * Creates a vector containing a list of unvisited blocks to be visited.
- * @param node: The current block.
- * @param targetLoc: The target block.
+* Finds the shortest paths from a starting location to the nearest of several destinations, with one search.
+* @param start: The starting location, there is no route from a wall.
+* @param targets: The destinations, the ones off the map or on a wall are never reached.
+* @param count: How many of the nearest destinations to find, all of them if it is 0.
+* @return routes: The routes to the destinations found, nearest first.
 */
-void AStar::addNeighboursToUnvisited(Block* node, Block* targetLoc) {
-    vector<Block*> neighbours = node->getNeighbour();
-    int parent_g_cost = node->getGCost();
-    for(Block* neighbour: neighbours){
-        // if neighbour is not wall
-        if(!neighbour->visited() && neighbour->getType() != 5) {
-            int row = neighbour->getRow();
-            int col = neighbour->getColumn();
-            bool updated = neighbour->updateGCost(row, col, parent_g_cost);
-            neighbour->calculateHCost(targetLoc->getRow(), targetLoc->getColumn());
-            if(updated) neighbour->setPrevBlock(node);
-            if(!neighbour->isInQueue()) {             
-                neighbour->setInQueue(true);
-                unvisited.push(neighbour);
-            } else {
-                // if this neighbour node is already in priority queue, then we change the min dist and update order
-                reorderPriorityQueue(node);
-            }   
-        }
-    }
+const vector<NearestRoute>& AStar::findNearest(const pair<int, int>& start, const vector<pair<int, int>>& targets, int count) {
+   LevelMap& map = *currentBoard->getMap();
+   const GraphView& graph = map.getGraph();
+   const ChainGraph& chains = map.getChains();
+   SearchWorkspace& workspace = SearchWorkspace::local();
+   ChainQuery& query = workspace.query;
+   query.startNodes.clear();
+   query.targetNodes.clear();
+   int startNode = graph.getNode(start.first, start.second);
+   if(startNode >= 0) {
+       query.startNodes.push_back(startNode);
+   }
+   addNodes(graph, targets, query.targetNodes);
+   findShortestPathOnMap(graph, chains, workspace, count);
+   TraceSpan span(PHASE_RESULT, currentBoard->getMapType());
+   for(int reached: workspace.reached) {
+       NearestRoute route;
+       int node = chains.getNode(query, reached);
+       route.target = find(targets.begin(), targets.end(), make_pair(graph.getRow(node), graph.getColumn(node))) - targets.begin();
+       route.cost = workspace.state.getCost(reached);
+       chains.appendPath(graph, query, workspace.state, reached, route.path);
+       workspace.routes.push_back(move(route));
+   }
+   return workspace.routes;
 }
 
 /**
- * Function to reorder the priority queue if the block is already in the queue.
- * @param node: The block to be pushed to the priority queue.
+* Finds the shortest path from any of several starting locations to any of several destinations, with one search
+* seeded from every starting location at once, so a building with several doors is routed as fast as a single block.
+* @param starts: The starting locations, the ones off the map or on a wall are left out.
+* @param targets: The destinations, the ones off the map or on a wall are never reached.
+* @return result: The blocks visited and the shortest path, which is empty if no destination can be reached.
 */
-void AStar::reorderPriorityQueue(Block* node) {
-    vector<Block*> temp_array;
-    Block* curr = unvisited.top();
-    bool sameCol = node->getColumn() == curr->getColumn();
-    bool sameRow = node->getRow() == curr->getRow();
-    bool sameNode = sameCol && sameRow;
-    while(!sameNode) {
-        if(!unvisited.empty()){
-            temp_array.push_back(curr);
-            unvisited.pop();
-            curr = unvisited.top();
-        } else {
-            break;
-        }
-    }
-    unvisited.pop();
-    unvisited.push(curr);
-    for(Block* b: temp_array) {
-        unvisited.push(b);
-    }
+const pair<vector<pair<int, int>>, vector<pair<int, int>>>& AStar::findRoute(const vector<pair<int, int>>& starts, const vector<pair<int, int>>& targets) {
+   LevelMap& map = *currentBoard->getMap();
+   const GraphView& graph = map.getGraph();
+   const ChainGraph& chains = map.getChains();
+   SearchWorkspace& workspace = SearchWorkspace::local();
+   ChainQuery& query = workspace.query;
+   query.startNodes.clear();
+   query.targetNodes.clear();
+   addNodes(graph, starts, query.startNodes);
+   addNodes(graph, targets, query.targetNodes);
+   findShortestPathOnMap(graph, chains, workspace, 1);
+   TraceSpan span(PHASE_RESULT, currentBoard->getMapType());
+   if(!workspace.reached.empty()) {
+       chains.appendPath(graph, query, workspace.state, workspace.reached[0], workspace.result.second);
+   }
+   return workspace.result;
 }
+
 /**
-* Finds the shortest distance between the start and target locations using AStar Algorithm.
-* @param startLoc: The starting block.
-* @param targetLoc: The destination block.
-* @return result: The shortest path.
+ * Distance from a block to the nearest target when every block on the way has weight 1.
+ * @param graph: The walkable blocks of the map searched.
+ * @param node: The block.
+ * @return h_cost: the H cost of the block.
 */
-pair<vector<pair<int, int>>, vector<pair<int, int>>> AStar::findShortestPathOnMap(Block* startLoc, Block* targetLoc) {
-    vector<pair<int, int>> visitedNode;
-    vector<pair<int, int>> shortestPathNodes;
-    unvisited.push(startLoc);
-    Block* curr = unvisited.top();
-    curr->calculateHCost(targetLoc->getRow(), targetLoc->getColumn());
-    curr->setGCost(0);
-    while(!unvisited.empty()){
-        if(curr->visited()){
-            unvisited.pop();
-            continue;
-        }   
-        unvisited.pop();
-        curr->setVisit(true);
-        // add its neighbours to priority queue
-        addNeighboursToUnvisited(curr, targetLoc);
-        int x = curr->getRow();
-        int y = curr->getColumn();
-        pair<int, int> node(x, y);
-        visitedNode.push_back(node);
-        if(curr == targetLoc) {
-            break;
-        }
-        curr = unvisited.top();
+int AStar::calculateHCost(const GraphView& graph, int node) {
+    int row = graph.getRow(node);
+    int col = graph.getColumn(node);
+    if(targetBlocks.size() > EXACT_TARGETS) {
+        // never more than the distance to the nearest target, and as cheap as a single target
+        return max(max(boxTop - row, row - boxBottom), 0) + max(max(boxLeft - col, col - boxRight), 0);
     }
-    if(curr == targetLoc) {
-        int row = curr->getRow();
-        int col = curr->getColumn();
-        pair<int, int> pathNode(row, col);
-        shortestPathNodes.insert(shortestPathNodes.begin(), pathNode);
-        while(curr->getPrevBlock()) {
-            int prevRow = curr->getPrevBlock()->getRow();
-            int prevCol = curr->getPrevBlock()->getColumn();
-            pathNode = make_pair(prevRow, prevCol);
-            shortestPathNodes.insert(shortestPathNodes.begin(), pathNode);
-            curr = curr->getPrevBlock();
-        }
+    int h_cost = SearchState::UNREACHED;
+    for(const pair<int, int>& target: targetBlocks) {
+        h_cost = min(h_cost, abs(target.first - row) + abs(target.second - col));
     }
-    pair<vector<pair<int, int>>, vector<pair<int, int>>> result(visitedNode, shortestPathNodes);
-    return result;
+    return h_cost;
 }
 
 /**
-* Method to sort the connection blocks from greatest to least in weight.
-* @param connections: the blocks to be sorted.
-* @return sortedConnections: the blocks sorted by weight.
+ * Creates a vector containing a list of unvisited blocks to be visited.
+ * @param graph: The walkable blocks of the map searched.
+ * @param chains: The junctions of the map and the corridors between them.
+ * @param query: The starts and targets of the search.
+ * @param workspace: The buffers of the search.
+ * @param node: The current junction.
 */
-vector<Block*> AStar::sortByWeight(vector<Block*> connections) {
-   vector<Block*> sortedConnections;
-   int numConnections = connections.size();
-   int numSortedConnections = 0;
-
-   //If there are no connections there is nothing to sort and return empty set of connections.
-   if(numConnections == 0) {
-       return connections;
-   }
-
-   //Sorts connection vector from highest to lowest weight and returns sorted vector.
-   for(int i = 0; i < numConnections; i++) {
-       Block* tempBlock = connections.at(numConnections-1);
-       connections.pop_back();
-       if(numSortedConnections == 0) {
-           sortedConnections.push_back(tempBlock);
-           numSortedConnections++;
-       }
-       else {
-           for(int j = numSortedConnections; j < numConnections; j++) {
-               if(tempBlock->getWeight() >= sortedConnections.at(j)->getWeight()) {
-                   vector<Block*>::iterator iter = sortedConnections.begin() + i;
-                   sortedConnections.insert(iter, tempBlock);
-                   numSortedConnections++;
-               }
-           }
-       }
-   }
-   return sortedConnections;
+void AStar::addNeighboursToUnvisited(const GraphView& graph, const ChainGraph& chains, const ChainQuery& query, SearchWorkspace& workspace, int node) {
+    SearchState& state = workspace.state;
+    int parent_g_cost = state.getCost(node);
+    ChainLink links[ChainGraph::MAX_LINKS];
+    int count = chains.getLinks(graph, query, node, links);
+    for(int i = 0; i < count; i++){
+        int neighbour = links[i].node;
+        // walls are not in the graph, a corridor leads straight to the junction at its other end
+        if(!state.visited(neighbour)) {
+            // distance from start node, the parent's G cost plus the weight of the blocks entered
+            int g_cost = parent_g_cost + links[i].cost;
+            if(g_cost < state.getCost(neighbour)) {
+                if(state.isInQueue(neighbour)) {
+                    // already queued with a higher cost, the old entry is skipped when popped
+                    stats.decreaseKeys++;
+                }
+                state.reach(neighbour, g_cost, links[i].via);
+                int h_cost = calculateHCost(graph, chains.getNode(query, neighbour));
+                workspace.push<astarcompare>({g_cost + h_cost, h_cost, neighbour});
+                stats.heapPushes++;
+            }
+        }
+    }
 }
 
 /**
-* Method to calculate the shortest distance between the starting node and each node in the grid.
-* @param currBlock: the node to compute the shortest distance from.
-* @param connections: the set of adjacent nodes.
+* Finds the shortest distances from the starts of the query in the workspace to its nearest targets using AStar Algorithm.
+* With several targets the H cost is the distance to the nearest of them, so targets are still found nearest first.
+* @param graph: The walkable blocks of the map searched.
+* @param chains: The junctions of the map and the corridors between them.
+* @param workspace: The buffers of the search, with the query filled in; the targets found are left in them.
+* @param count: How many targets to find before stopping, 0 to find all of them.
 */
-
-void AStar::calculateShortestDistance(Block* currBlock, vector<Block*> connections)
-{
-   for(int i = 0; i < connections.size(); i++) {
-       //Get the block's connections and calculate their distance from the starting node.
-       Block* nextBlock = connections.at(i);
-       if(nextBlock->visited()) continue;
-       int dist = nextBlock->getWeight() + currBlock->getMinDistance();
-
-       //If the distance found to the block is shorter than the previously stored distance set the smaller distance to the min distance.
-       if (dist < nextBlock->getMinDistance()) {
-           nextBlock->setMinDistance(dist);
-       }
-       calculateShortestDistance(nextBlock, sortByWeight(currBlock->getNeighbour()));
-   }
+void AStar::findShortestPathOnMap(const GraphView& graph, const ChainGraph& chains, SearchWorkspace& workspace, int count) {
+    ChainQuery& query = workspace.query;
+    chains.placeQuery(query);
+    // forget what a previous run on this thread found
+    workspace.begin(chains.getSearchNodeCount(query));
+    SearchState& state = workspace.state;
+    vector<pair<int, int>>& visitedNode = workspace.result.first;
+    stats = SearchStats();
+    if(query.targets.empty()) {
+        return;
+    }
+    targetBlocks.clear();
+    for(size_t i = 0; i < query.targets.size(); i++) {
+        state.setTarget(query.targets[i]);
+        targetBlocks.push_back(make_pair(graph.getRow(query.targetNodes[i]), graph.getColumn(query.targetNodes[i])));
+    }
+    boxTop = boxLeft = SearchState::UNREACHED;
+    boxBottom = boxRight = -1;
+    for(const pair<int, int>& target: targetBlocks) {
+        boxTop = min(boxTop, target.first);
+        boxBottom = max(boxBottom, target.first);
+        boxLeft = min(boxLeft, target.second);
+        boxRight = max(boxRight, target.second);
+    }
+    for(size_t i = 0; i < query.starts.size(); i++) {
+        // a start given twice is queued once
+        if(state.getCost(query.starts[i]) > 0) {
+            int startHCost = calculateHCost(graph, query.startNodes[i]);
+            state.reach(query.starts[i], 0, -1);
+            workspace.push<astarcompare>({startHCost, startHCost, query.starts[i]});
+            stats.heapPushes++;
+        }
+    }
+    while(!workspace.frontier.empty()){
+        int curr = workspace.pop<astarcompare>().block;
+        stats.heapPops++;
+        if(state.visited(curr)){
+            continue;
+        }   
+        state.setVisit(curr);
+        stats.expansions++;
+        // the blocks of the corridor it was reached over, then the junction
+        chains.appendReached(graph, query, state, curr, visitedNode);
+        if(state.isTarget(curr)) {
+            workspace.reached.push_back(curr);
+            if((int) workspace.reached.size() == count) {
+                break;
+            }
+        }
+        // add its neighbours to priority queue
+        addNeighboursToUnvisited(graph, chains, query, workspace, curr);
+    }
 }
\ No newline at end of file
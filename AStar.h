@@ -7,30 +7,31 @@
 #define ASTAR_H
 
 #pragma once
-#include <queue>
 #include <unistd.h>
 #include <vector>
 #include "Algorithm.h"
 #include "Block.h"
+#include "ChainGraph.h"
+#include "GraphView.h"
+#include "SearchWorkspace.h"
 
 /**
 * Custom comparison definition to compare the cost of paths
-* @param a: A path of nodes
-* @param b: A path of nodes to compare 
+* @param a: A queued block
+* @param b: A queued block to compare 
 * @return a_f_cost > b_f_cost: A comparison for finding lower costs
 */
 struct astarcompare {
-    bool operator()(Block* const& a,Block* const& b)
+    bool operator()(const FrontierEntry& a, const FrontierEntry& b) const
     {
         // if f_cost = g_cost + h_cost is equal, then we should put smaller h_cost node
-        int a_f_cost = a->getGCost() + a->getHCost();
-        int b_f_cost = b->getGCost() + b->getHCost();
-        if(a_f_cost == b_f_cost){
-            return a->getHCost() > b->getHCost();
+        if(a.cost == b.cost){
+            return a.tieBreak > b.tieBreak;
         }
-        return a_f_cost > b_f_cost;
+        return a.cost > b.cost;
     }
 };
+
 /**
 * AStar pathfinding algorithm definition 
 * @param board: Pointer reference to current board
@@ -41,15 +42,21 @@ class AStar : public Algorithm
        AStar(Board* board) {
            currentBoard = board;
        }
-       std::pair<std::vector<std::pair<int, int>>, std::vector<std::pair<int, int>>> runAlgorithm();
+       const std::pair<std::vector<std::pair<int, int>>, std::vector<std::pair<int, int>>>& runAlgorithm();
+       const std::vector<NearestRoute>& findNearest(const std::pair<int, int>& start, const std::vector<std::pair<int, int>>& targets, int count);
+       const std::pair<std::vector<std::pair<int, int>>, std::vector<std::pair<int, int>>>& findRoute(const std::vector<std::pair<int, int>>& starts,
+                                                                                                    const std::vector<std::pair<int, int>>& targets);
    private:
-       std::vector<Block*> visited;
-       std::priority_queue<Block*, std::vector<Block*>, astarcompare> unvisited;
-       void reorderPriorityQueue(Block* node);
-       void addNeighboursToUnvisited(Block* node, Block* targetLoc);
-       int distance = 0;
-       std::pair<std::vector<std::pair<int, int>>, std::vector<std::pair<int, int>>> findShortestPathOnMap(Block* startLoc, Block* targetLoc);
-       std::vector<Block*> sortByWeight(std::vector<Block*> connections);
-       void calculateShortestDistance(Block* currNode, std::vector<Block*> connections);
+       // the targets of the running search, as row and column
+       std::vector<std::pair<int, int>> targetBlocks;
+       // with more targets than this the H cost is the distance to the rectangle around them
+       static const size_t EXACT_TARGETS = 8;
+       int boxTop;
+       int boxBottom;
+       int boxLeft;
+       int boxRight;
+       int calculateHCost(const GraphView& graph, int node);
+       void addNeighboursToUnvisited(const GraphView& graph, const ChainGraph& chains, const ChainQuery& query, SearchWorkspace& workspace, int node);
+       void findShortestPathOnMap(const GraphView& graph, const ChainGraph& chains, SearchWorkspace& workspace, int count);
 };
 #endif
\ No newline at end of file
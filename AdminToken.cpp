@@ -0,0 +1,52 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: Token the administrators of the server send to change overlays and read the memory of the sessions.
+*/
+
+#include "AdminToken.h"
+
+std::string AdminToken::token_;
+
+/**
+ * @brief Sets the token, before the server starts listening.
+ * @param token, the token of the administrators, empty to refuse every request.
+*/
+void AdminToken::setToken(const std::string& token)
+{
+  token_ = token;
+}
+
+/**
+ * @brief Checks the token of a request. The whole token is compared whatever the first wrong character,
+ * so the time of the answer does not tell how much of a guess was right.
+ * @param request, the HTTP request.
+ * @return true if a token is set and the request carries it.
+*/
+bool AdminToken::isAuthorized(const Wt::Http::Request& request)
+{
+  const std::string prefix = "Bearer ";
+  std::string header = request.headerValue("Authorization");
+  if(token_.empty() || header.compare(0, prefix.size(), prefix) != 0 || header.size() - prefix.size() != token_.size()) {
+    return false;
+  }
+  unsigned char difference = 0;
+  for(size_t i = 0; i < token_.size(); i++) {
+    difference |= header[prefix.size() + i] ^ token_[i];
+  }
+  return difference == 0;
+}
+
+/**
+ * @brief Answers a request without the token with status 403 and {"error":"..."}.
+ * @param response, the HTTP response.
+*/
+void AdminToken::sendForbidden(Wt::Http::Response& response)
+{
+  std::string body = token_.empty() ? "{\"error\":\"no administrator token is set on the server\"}"
+                                    : "{\"error\":\"the Authorization header does not carry the administrator token\"}";
+  response.setStatus(403);
+  response.setMimeType("application/json");
+  response.setContentLength(body.size());
+  response.out() << body;
+}
@@ -0,0 +1,30 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: Token the administrators of the server send to change overlays and read the memory of the sessions.
+*/
+
+#ifndef ADMINTOKEN_H
+#define ADMINTOKEN_H
+
+#include <Wt/Http/Request.h>
+#include <Wt/Http/Response.h>
+#include <string>
+
+/**
+* The token of the administrators, set once when the server starts, from NAVI_ADMIN_TOKEN. A request is let
+* through when it carries the header "Authorization: Bearer <token>". Without a token every such request
+* is refused, so a server started without one publishes no overlay and shows no session.
+*/
+class AdminToken
+{
+public:
+    static void setToken(const std::string& token);
+    static bool isAuthorized(const Wt::Http::Request& request);
+    static void sendForbidden(Wt::Http::Response& response);
+
+private:
+    static std::string token_;
+};
+
+#endif
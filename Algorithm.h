@@ -7,8 +7,25 @@
 #ifndef ALGORITHM_H
 #define ALGORITHM_H
 
+#include <utility>
 #include <vector>
 #include "Board.h"
+#include "SearchWorkspace.h"
+
+/**
+* Counters describing the work done by the last search.
+*/
+struct SearchStats
+{
+    // blocks taken off the queue and expanded
+    long expansions = 0;
+    // entries pushed onto the queue, including the ones from decreaseKeys
+    long heapPushes = 0;
+    // entries popped off the queue, including the outdated ones that are skipped
+    long heapPops = 0;
+    // pushes of a block that was already queued, because a shorter way to it was found
+    long decreaseKeys = 0;
+};
 
 /**
 * Abstract algorithm class and connects it to current board.
@@ -17,8 +34,28 @@ class Algorithm
 {
    protected:
        Board* currentBoard;
+       SearchStats stats;
+       // adds the nodes of blocks to the starts or targets of a query, blocks off the map or on a wall have none
+       static void addNodes(const GraphView& graph, const std::vector<std::pair<int, int>>& blocks, std::vector<int>& nodes) {
+           for(const std::pair<int, int>& block: blocks) {
+               int node = graph.getNode(block.first, block.second);
+               if(node >= 0) {
+                   nodes.push_back(node);
+               }
+           }
+       }
    public:
-       virtual std::pair<std::vector<std::pair<int, int>>, std::vector<std::pair<int, int>>> runAlgorithm() = 0;
+       virtual ~Algorithm() {}
+       // the result is kept in the SearchWorkspace of the calling thread, until its next search
+       virtual const std::pair<std::vector<std::pair<int, int>>, std::vector<std::pair<int, int>>>& runAlgorithm() = 0;
+       // routes from a start to the count nearest of several targets, found by one search
+       virtual const std::vector<NearestRoute>& findNearest(const std::pair<int, int>& start, const std::vector<std::pair<int, int>>& targets, int count) = 0;
+       // the shortest route from any of several starts to any of several targets, found by one search from all starts
+       virtual const std::pair<std::vector<std::pair<int, int>>, std::vector<std::pair<int, int>>>& findRoute(
+           const std::vector<std::pair<int, int>>& starts, const std::vector<std::pair<int, int>>& targets) = 0;
+       const SearchStats& getLastStats() const {
+           return stats;
+       }
 };
 
 #endif
\ No newline at end of file
@@ -6,6 +6,7 @@
 #ifndef ALGORITHMFACTORY_H
 #define ALGORITHMFACTORY_H
 
+#include <string>
 #include "Dijkstra.h"
 #include "AStar.h"
 
@@ -17,7 +18,10 @@
 */
 class AlgorithmFactory {
     public:
-        Algorithm* createAlgorithmInstance(int type, Board* board) {
+        // number of algorithm types, valid types are 0 to ALGORITHM_COUNT - 1
+        static const int ALGORITHM_COUNT = 2;
+
+        static Algorithm* createAlgorithmInstance(int type, Board* board) {
             Algorithm* instance;
             switch(type) {
                 case 0:
@@ -32,6 +36,30 @@ class AlgorithmFactory {
             }
             return instance;
         }
+
+        /**
+         * Name of an algorithm type, for reports and logs
+         * @param type: Integer presenting algorithm type
+         * @return name: A short name of the algorithm
+        */
+        static const std::string& getAlgorithmName(int type) {
+            static const std::string names[] = {"dijkstra", "astar"};
+            return type == 1 ? names[1] : names[0];
+        }
+
+        /**
+         * Algorithm type of a name given by getAlgorithmName
+         * @param name: A short name of the algorithm
+         * @return type: Integer presenting algorithm type, -1 if the name is unknown
+        */
+        static int findAlgorithmType(const std::string& name) {
+            for(int type = 0; type < ALGORITHM_COUNT; type++) {
+                if(getAlgorithmName(type) == name) {
+                    return type;
+                }
+            }
+            return -1;
+        }
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,303 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: The shortest routes between the start and the target of a map, as alternatives to the shortest one.
+*/
+
+#include "AlternativeRoutes.h"
+#include <algorithm>
+#include <cstdlib>
+#include "AStar.h"
+
+/**
+* Prepares a search for the alternative routes between two blocks of a map.
+* @param map: the map, its graphs are built if they are not yet.
+* @param workspace: the buffers of the calling thread.
+* @param startBlock: the start as row and column.
+* @param targetBlock: the target as row and column.
+*/
+AlternativeRoutes::AlternativeRoutes(LevelMap& map, SearchWorkspace& workspace, const std::pair<int, int>& startBlock,
+                                     const std::pair<int, int>& targetBlock)
+    : graph(map.getGraph()), chains(map.getChains()), workspace(workspace), startBlock(startBlock), targetBlock(targetBlock) {
+}
+
+/**
+* Finds the count shortest loopless routes from the start to the target.
+* @param count: how many routes to find, the shortest one included.
+* @return routes: the routes found, cheapest first, each with target 0; fewer than count if there are no more.
+*/
+const std::vector<NearestRoute>& AlternativeRoutes::find(int count) {
+    stats = SearchStats();
+    ChainQuery& query = workspace.query;
+    query.startNodes.clear();
+    query.targetNodes.clear();
+    int startNode = graph.getNode(startBlock.first, startBlock.second);
+    int targetNode = graph.getNode(targetBlock.first, targetBlock.second);
+    if(startNode >= 0 && targetNode >= 0) {
+        query.startNodes.push_back(startNode);
+        query.targetNodes.push_back(targetNode);
+    }
+    chains.placeQuery(query);
+    nodeCount = chains.getSearchNodeCount(query);
+    workspace.begin(nodeCount);
+    if(query.starts.empty()) {
+        return workspace.routes;
+    }
+    start = query.starts[0];
+    target = query.targets[0];
+    startWeight = graph.getWeight(startNode);
+    targetWeight = graph.getWeight(targetNode);
+    searchStartTree();
+
+    pathsUsed = 0;
+    // the routes found, cheapest first, and the candidates for the next one, cheapest first
+    std::vector<int> found;
+    std::vector<int> candidates;
+    int first = newPath();
+    workspace.paths[first].nodes.push_back(target);
+    workspace.paths[first].links.push_back(-1);
+    workspace.paths[first].costs.push_back(0);
+    workspace.blockedLinks.clear();
+    if(!searchSpur(first, SearchState::UNREACHED)) {
+        return workspace.routes;
+    }
+    found.push_back(first);
+    std::vector<int>& positions = workspace.pathPositions;
+    while((int) found.size() < count) {
+        int last = found.back();
+        // the root of a spur node is the part of the last route before it
+        for(size_t i = 0; i < workspace.paths[last].nodes.size(); i++) {
+            positions[workspace.paths[last].nodes[i]] = i;
+        }
+        for(size_t spur = 0; spur + 1 < workspace.paths[last].nodes.size(); spur++) {
+            // an alternative that is not cheaper than the candidates still needed cannot be one of the routes
+            int needed = count - found.size();
+            int limit = (int) candidates.size() >= needed ? workspace.paths[candidates[needed - 1]].costs.back() : SearchState::UNREACHED;
+            int index = newPath();
+            const ChainPath& previous = workspace.paths[last];
+            ChainPath& path = workspace.paths[index];
+            path.nodes.assign(previous.nodes.begin(), previous.nodes.begin() + spur + 1);
+            path.links.assign(previous.links.begin(), previous.links.begin() + spur + 1);
+            path.costs.assign(previous.costs.begin(), previous.costs.begin() + spur + 1);
+            // the routes found with the same root may not be followed again
+            workspace.blockedLinks.clear();
+            for(int other: found) {
+                const ChainPath& route = workspace.paths[other];
+                if(route.nodes.size() > spur + 1 && std::equal(path.links.begin(), path.links.end(), route.links.begin())
+                   && std::equal(path.nodes.begin(), path.nodes.end(), route.nodes.begin())) {
+                    workspace.blockedLinks.push_back(route.links[spur + 1]);
+                }
+            }
+            if(searchSpur(index, limit) && !isKnown(index, found, candidates)) {
+                auto place = std::upper_bound(candidates.begin(), candidates.end(), workspace.paths[index].costs.back(), [this](int cost, int other) {
+                    return cost < workspace.paths[other].costs.back();
+                });
+                candidates.insert(place, index);
+            } else {
+                // the unused route is the last one taken from the pool
+                pathsUsed--;
+            }
+        }
+        for(int node: workspace.paths[last].nodes) {
+            positions[node] = -1;
+        }
+        if(candidates.empty()) {
+            break;
+        }
+        found.push_back(candidates.front());
+        candidates.erase(candidates.begin());
+    }
+
+    for(int index: found) {
+        const ChainPath& path = workspace.paths[index];
+        NearestRoute route;
+        route.target = 0;
+        // the routes were searched from the target, whose weight the cost leaves out instead of the weight of the start
+        route.cost = path.costs.back() - startWeight + targetWeight;
+        for(size_t i = path.nodes.size() - 1; i > 0; i--) {
+            int node = chains.getNode(query, path.nodes[i]);
+            route.path.push_back(std::make_pair(graph.getRow(node), graph.getColumn(node)));
+            chains.appendLink(graph, query, path.nodes[i], path.links[i], route.path);
+        }
+        route.path.push_back(targetBlock);
+        workspace.routes.push_back(std::move(route));
+    }
+    return workspace.routes;
+}
+
+/**
+* Runs A* from the start to the target and keeps the cost from the start of every node it expanded, which is
+* exact, and for the others the cost of the target less their distance to it, which is never more than theirs:
+* A* expands every node whose cost and distance to the target add up to less than the cost of the target.
+*/
+void AlternativeRoutes::searchStartTree() {
+    SearchState& state = workspace.state;
+    int startDistance = distanceToTarget(start);
+    state.reach(start, 0, -1);
+    workspace.push<astarcompare>({startDistance, startDistance, start});
+    stats.heapPushes++;
+    int radius = SearchState::UNREACHED;
+    while(!workspace.frontier.empty()) {
+        int curr = workspace.pop<astarcompare>().block;
+        stats.heapPops++;
+        if(state.visited(curr)) {
+            continue;
+        }
+        state.setVisit(curr);
+        stats.expansions++;
+        if(curr == target) {
+            radius = state.getCost(curr);
+            break;
+        }
+        int cost = state.getCost(curr);
+        ChainLink links[ChainGraph::MAX_LINKS];
+        int count = chains.getLinks(graph, workspace.query, curr, links);
+        for(int i = 0; i < count; i++) {
+            int neighbour = links[i].node;
+            if(!state.visited(neighbour) && cost + links[i].cost < state.getCost(neighbour)) {
+                if(state.isInQueue(neighbour)) {
+                    stats.decreaseKeys++;
+                }
+                int h_cost = distanceToTarget(neighbour);
+                state.reach(neighbour, cost + links[i].cost, links[i].via);
+                workspace.push<astarcompare>({cost + links[i].cost + h_cost, h_cost, neighbour});
+                stats.heapPushes++;
+            }
+        }
+    }
+    workspace.startCosts.resize(nodeCount);
+    workspace.pathPositions.assign(nodeCount, -1);
+    for(int node = 0; node < nodeCount; node++) {
+        workspace.startCosts[node] = state.visited(node) ? state.getCost(node) : radius - distanceToTarget(node);
+    }
+}
+
+/**
+* Distance from a search node to the target when every block on the way has weight 1.
+* @param node: the search node.
+* @return distance: the A* estimate of the search from the start.
+*/
+int AlternativeRoutes::distanceToTarget(int node) const {
+    int block = chains.getNode(workspace.query, node);
+    return std::abs(graph.getRow(block) - targetBlock.first) + std::abs(graph.getColumn(block) - targetBlock.second);
+}
+
+/**
+* A* estimate of the cost from a node to the start, never more than the cost of any route and never more than
+* the cost of a link plus the estimate of the node it leads to.
+* @param node: the search node.
+* @return estimate: the cost kept from the start, turned around, or the distance if that is more.
+*/
+int AlternativeRoutes::estimate(int node) const {
+    int block = chains.getNode(workspace.query, node);
+    // a route walked the other way enters the start instead of the node
+    int turned = workspace.startCosts[node] - graph.getWeight(block) + startWeight;
+    int distance = std::abs(graph.getRow(block) - startBlock.first) + std::abs(graph.getColumn(block) - startBlock.second);
+    return std::max(turned, distance);
+}
+
+/**
+* Takes a route from the pool of the workspace, which may move the routes already taken.
+* @return index: the route, empty.
+*/
+int AlternativeRoutes::newPath() {
+    if(pathsUsed == (int) workspace.paths.size()) {
+        workspace.paths.emplace_back();
+    }
+    ChainPath& path = workspace.paths[pathsUsed];
+    path.nodes.clear();
+    path.links.clear();
+    path.costs.clear();
+    return pathsUsed++;
+}
+
+/**
+* Extends a root to the start with A* from its last node, the spur node, without walking the root again and
+* without leaving the spur node by the links in blockedLinks of the workspace. The nodes of the root are the
+* ones with a pathPosition in the workspace below that of the spur node.
+* @param index: the route in the pool, holding the root.
+* @param limit: the route is only wanted if it costs less.
+* @return true if the route was extended to the start.
+*/
+bool AlternativeRoutes::searchSpur(int index, int limit) {
+    ChainPath& path = workspace.paths[index];
+    const ChainQuery& query = workspace.query;
+    SearchState& state = workspace.state;
+    const std::vector<int>& positions = workspace.pathPositions;
+    int spur = path.nodes.back();
+    int spurPosition = path.nodes.size() - 1;
+    int rootCost = path.costs.back();
+    state.begin(nodeCount);
+    workspace.frontier.clear();
+    int spurEstimate = estimate(spur);
+    state.reach(spur, 0, -1);
+    workspace.push<astarcompare>({spurEstimate, spurEstimate, spur});
+    stats.heapPushes++;
+    while(!workspace.frontier.empty()) {
+        FrontierEntry entry = workspace.pop<astarcompare>();
+        int curr = entry.block;
+        stats.heapPops++;
+        if(state.visited(curr)) {
+            continue;
+        }
+        if(rootCost + entry.cost >= limit) {
+            return false;
+        }
+        state.setVisit(curr);
+        stats.expansions++;
+        if(curr == start) {
+            size_t begin = path.nodes.size();
+            for(int node = start; node != spur; node = chains.getLinkSource(query, state.getPrev(node))) {
+                path.nodes.push_back(node);
+                path.links.push_back(state.getPrev(node));
+                path.costs.push_back(rootCost + state.getCost(node));
+            }
+            std::reverse(path.nodes.begin() + begin, path.nodes.end());
+            std::reverse(path.links.begin() + begin, path.links.end());
+            std::reverse(path.costs.begin() + begin, path.costs.end());
+            return true;
+        }
+        int cost = state.getCost(curr);
+        ChainLink links[ChainGraph::MAX_LINKS];
+        int count = chains.getLinks(graph, query, curr, links);
+        for(int i = 0; i < count; i++) {
+            int neighbour = links[i].node;
+            if(positions[neighbour] >= 0 && positions[neighbour] < spurPosition) {
+                continue;
+            }
+            if(curr == spur && std::find(workspace.blockedLinks.begin(), workspace.blockedLinks.end(), links[i].via) != workspace.blockedLinks.end()) {
+                continue;
+            }
+            if(!state.visited(neighbour) && cost + links[i].cost < state.getCost(neighbour)) {
+                if(state.isInQueue(neighbour)) {
+                    stats.decreaseKeys++;
+                }
+                int h_cost = estimate(neighbour);
+                state.reach(neighbour, cost + links[i].cost, links[i].via);
+                workspace.push<astarcompare>({cost + links[i].cost + h_cost, h_cost, neighbour});
+                stats.heapPushes++;
+            }
+        }
+    }
+    return false;
+}
+
+/**
+* Checks whether a route was found before, as a route or as a candidate.
+* @param index: the route.
+* @param found: the routes found.
+* @param candidates: the candidates.
+* @return true if one of them walks the same links.
+*/
+bool AlternativeRoutes::isKnown(int index, const std::vector<int>& found, const std::vector<int>& candidates) const {
+    const ChainPath& path = workspace.paths[index];
+    for(const std::vector<int>* known: {&found, &candidates}) {
+        for(int other: *known) {
+            const ChainPath& route = workspace.paths[other];
+            if(route.costs.back() == path.costs.back() && route.links == path.links && route.nodes == path.nodes) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
@@ -0,0 +1,61 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: The shortest routes between the start and the target of a map, as alternatives to the shortest one.
+*/
+
+#ifndef ALTERNATIVEROUTES_H
+#define ALTERNATIVEROUTES_H
+
+#include <vector>
+#include "Algorithm.h"
+#include "ChainGraph.h"
+#include "GraphView.h"
+#include "LevelMap.h"
+#include "SearchWorkspace.h"
+
+/**
+* Finds the k shortest loopless routes between two blocks of a map with Yen's algorithm, on the
+* junctions of the map. Every alternative leaves a route found before at a spur node: the part of that route
+* up to the spur node, the root, is kept and a search from the spur node finds the rest, without the nodes
+* of the root and without the links by which the routes found before leave the spur node with the same root.
+*
+* The searches run from the target back to the start. A single A* search from the start to the target gives
+* every spur search its estimate: the exact cost to the start of every node it expanded and a lower bound for
+* the others. So a spur search mostly expands the detour it finds, and one that
+* cannot beat the alternatives already found stops as soon as its estimate says so. The spur searches share
+* the search state of the thread, reset by its epoch instead of cleared.
+*/
+class AlternativeRoutes {
+    public:
+        AlternativeRoutes(LevelMap& map, SearchWorkspace& workspace, const std::pair<int, int>& startBlock, const std::pair<int, int>& targetBlock);
+        const std::vector<NearestRoute>& find(int count);
+        const SearchStats& getStats() const {
+            return stats;
+        }
+    private:
+        const GraphView& graph;
+        const ChainGraph& chains;
+        SearchWorkspace& workspace;
+        std::pair<int, int> startBlock;
+        std::pair<int, int> targetBlock;
+        SearchStats stats;
+        // search nodes of the query placed by find
+        int start;
+        int target;
+        int nodeCount;
+        // the weights of the blocks of the start and the target
+        int startWeight;
+        int targetWeight;
+        // routes of the workspace pool in use
+        int pathsUsed;
+
+        void searchStartTree();
+        int distanceToTarget(int node) const;
+        int estimate(int node) const;
+        int newPath();
+        bool searchSpur(int index, int limit);
+        bool isKnown(int index, const std::vector<int>& found, const std::vector<int>& candidates) const;
+};
+
+#endif
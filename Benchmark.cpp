@@ -0,0 +1,396 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: Benchmark of every pathfinding algorithm on the classic board, the campus map and synthetic grids.
+*
+* Usage: naviBench [--json file] [--queries n] [--check-allocations]
+* The campus is also routed between whole buildings, every door or every side of one to those of another.
+* For every map and algorithm it reports the time per query, expansions per second, queue operations,
+* heap allocations per query and the peak resident memory, and writes the same numbers as JSON.
+* With --check-allocations the run fails if a query allocates once the search workspace is warm.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+#include <sys/resource.h>
+#include "AlgorithmFactory.h"
+#include "BuildingDictionary.h"
+#include "LogicServer.h"
+
+// GCC takes the malloc and free of the replaced operators below, once inlined, for a mismatched pair
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+// every heap allocation of the process goes through these counters
+static long allocationCount = 0;
+static long allocatedBytes = 0;
+
+void* operator new(std::size_t size) {
+    allocationCount++;
+    allocatedBytes += size;
+    void* memory = std::malloc(size == 0 ? 1 : size);
+    if(!memory) {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic pop
+#endif
+
+/**
+* One map of the benchmark and the queries to run on it.
+*/
+struct Workload {
+    std::string name;
+    std::string kind;
+    // 0 classic, 1 campus, 2 synthetic
+    int mapType;
+    int rows;
+    int cols;
+    double wallDensity;
+    std::vector<std::pair<std::pair<int, int>, std::pair<int, int>>> queries;
+    // with a scope of the BuildingDictionary, the queries are between the buildings of these ids instead
+    int scope = -1;
+    std::vector<std::pair<int, int>> buildingQueries = {};
+};
+
+/**
+* Result of one algorithm on one workload.
+*/
+struct Measurement {
+    std::string workload;
+    std::string kind;
+    std::string algorithm;
+    int rows;
+    int cols;
+    double wallDensity;
+    long queries;
+    double nsPerQuery;
+    double expansionsPerSecond;
+    double expansionsPerQuery;
+    double heapPushesPerQuery;
+    double heapPopsPerQuery;
+    double decreaseKeysPerQuery;
+    double allocationsPerQuery;
+    double allocatedBytesPerQuery;
+    double pathLengthPerQuery;
+    long peakRssKb;
+};
+
+/**
+* Returns the peak resident set size of the process.
+* @return peak: the peak RSS in kilobytes.
+*/
+static long peakRssKb() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+/**
+* Puts walls on a custom map at random and returns the walkable blocks.
+* @param board: the board whose custom map is filled.
+* @param density: the fraction of blocks to turn into walls.
+* @param random: the random generator.
+* @return open: the blocks that are not walls.
+*/
+static std::vector<std::pair<int, int>> addRandomWalls(Board& board, double density, std::mt19937& random) {
+    std::vector<std::pair<int, int>> open;
+    std::uniform_real_distribution<double> coin(0.0, 1.0);
+    LevelMap* map = board.getMap();
+    for(int row = 0; row < map->getRows(); row++) {
+        for(int col = 0; col < map->getColumns(); col++) {
+            if(coin(random) < density) {
+                board.changeBlockInMap(row, col, 5);
+            } else {
+                open.push_back(std::make_pair(row, col));
+            }
+        }
+    }
+    return open;
+}
+
+/**
+* Picks random start and target pairs among the given blocks.
+* @param blocks: the blocks to pick from.
+* @param count: the number of pairs.
+* @param random: the random generator.
+* @return queries: the start and target pairs.
+*/
+static std::vector<std::pair<std::pair<int, int>, std::pair<int, int>>> randomQueries(const std::vector<std::pair<int, int>>& blocks, int count, std::mt19937& random) {
+    std::vector<std::pair<std::pair<int, int>, std::pair<int, int>>> queries;
+    std::uniform_int_distribution<int> pick(0, blocks.size() - 1);
+    for(int i = 0; i < count; i++) {
+        queries.push_back(std::make_pair(blocks[pick(random)], blocks[pick(random)]));
+    }
+    return queries;
+}
+
+/**
+* Sets up the board for a workload.
+* @param board: the board to set up.
+* @param workload: the workload.
+*/
+static void prepareBoard(Board& board, const Workload& workload) {
+    if(workload.mapType == 2) {
+        board.initCustomMap(workload.rows, workload.cols);
+        std::mt19937 random(workload.rows * 1000 + (int) (workload.wallDensity * 100));
+        addRandomWalls(board, workload.wallDensity, random);
+    } else {
+        board.switchMap(workload.mapType);
+    }
+}
+
+/**
+* Builds the list of workloads: classic board, campus map and synthetic grids of growing size and density.
+* @param queriesPerMap: the number of queries on each map.
+* @return workloads: every workload of the benchmark.
+*/
+static std::vector<Workload> createWorkloads(int queriesPerMap) {
+    std::vector<Workload> workloads;
+    std::mt19937 random(42);
+
+    Workload classic = {"classic", "classic", 0, 20, 52, 0.0, {}};
+    std::vector<std::pair<int, int>> classicBlocks;
+    for(int row = 0; row < 20; row++) {
+        for(int col = 0; col < 52; col++) {
+            classicBlocks.push_back(std::make_pair(row, col));
+        }
+    }
+    classic.queries.push_back(std::make_pair(std::make_pair(10, 12), std::make_pair(10, 40)));
+    for(const auto& query: randomQueries(classicBlocks, queriesPerMap - 1, random)) {
+        classic.queries.push_back(query);
+    }
+    workloads.push_back(classic);
+
+    Workload campus = {"campus", "campus", 1, 200, 168, 0.0, {}};
+    std::vector<std::pair<int, int>> entrances;
+    for(const BuildingInfo& building: BuildingDictionary::getInstance().getBuildings()) {
+        entrances.push_back(building.getEntrance());
+    }
+    campus.queries = randomQueries(entrances, queriesPerMap, random);
+    workloads.push_back(campus);
+
+    int sizes[] = {64, 128, 256, 512};
+    double densities[] = {0.0, 0.2, 0.35};
+    for(int size: sizes) {
+        for(double density: densities) {
+            Workload synthetic = {"grid-" + std::to_string(size) + "-" + std::to_string((int) (density * 100)), "synthetic", 2, size, size, density, {}};
+            Board board;
+            prepareBoard(board, synthetic);
+            std::vector<std::pair<int, int>> open;
+            for(int row = 0; row < size; row++) {
+                for(int col = 0; col < size; col++) {
+                    if(board.getMap()->getNode(row, col)->getType() != 5) {
+                        open.push_back(std::make_pair(row, col));
+                    }
+                }
+            }
+            // larger grids get fewer queries so every workload takes about the same time
+            int count = std::max(5, queriesPerMap * 64 / size);
+            synthetic.queries = randomQueries(open, count, random);
+            workloads.push_back(synthetic);
+        }
+    }
+
+    // the same pairs of buildings routed between all their doors and between all their sides
+    Workload doors = {"campus-doors", "buildings", 1, 200, 168, 0.0, {}};
+    doors.scope = BuildingDictionary::ENTRANCES;
+    std::uniform_int_distribution<int> pickBuilding(0, BuildingDictionary::getInstance().getBuildingCount() - 1);
+    for(int i = 0; i < queriesPerMap; i++) {
+        doors.buildingQueries.push_back(std::make_pair(pickBuilding(random), pickBuilding(random)));
+    }
+    workloads.push_back(doors);
+    Workload sides = doors;
+    sides.name = "campus-sides";
+    sides.scope = BuildingDictionary::FOOTPRINT;
+    workloads.push_back(sides);
+    return workloads;
+}
+
+/**
+* Runs one algorithm over every query of a workload.
+* @param workload: the map and queries.
+* @param type: the algorithm type.
+* @return measurement: the averaged counters.
+*/
+static Measurement runWorkload(const Workload& workload, int type) {
+    Board board;
+    prepareBoard(board, workload);
+    LogicServer logicServer(&board);
+    // the algorithms are measured, not the route cache
+    logicServer.setCacheEnabled(false);
+    logicServer.setAlgorithm(type, &board);
+    LevelMap* map = board.getMap();
+    // the cells of every building, looked up before the queries are timed
+    std::vector<std::vector<std::pair<int, int>>> buildingCells;
+    if(workload.scope >= 0) {
+        const BuildingDictionary& dictionary = BuildingDictionary::getInstance();
+        buildingCells.resize(dictionary.getBuildingCount());
+        for(int id = 0; id < dictionary.getBuildingCount(); id++) {
+            dictionary.appendBuildingCells(id, workload.scope, *map, buildingCells[id]);
+        }
+    }
+
+    // one untimed pass so the search workspace of the thread has grown to the largest query
+    for(const auto& query: workload.queries) {
+        map->setStartPoint(query.first.first, query.first.second);
+        map->setTargetPoint(query.second.first, query.second.second);
+        logicServer.runAlgorithm();
+    }
+    for(const auto& query: workload.buildingQueries) {
+        logicServer.findRoute(buildingCells[query.first], buildingCells[query.second]);
+    }
+
+    SearchStats total;
+    long totalPath = 0;
+    long elapsedNs = 0;
+    long allocationsBefore = allocationCount;
+    long bytesBefore = allocatedBytes;
+    // a workload has either queries between blocks or queries between buildings
+    size_t blockQueries = workload.queries.size();
+    for(size_t i = 0; i < blockQueries + workload.buildingQueries.size(); i++) {
+        std::chrono::steady_clock::time_point start;
+        const std::vector<std::pair<int, int>>* path;
+        if(i < blockQueries) {
+            const auto& query = workload.queries[i];
+            map->setStartPoint(query.first.first, query.first.second);
+            map->setTargetPoint(query.second.first, query.second.second);
+            start = std::chrono::steady_clock::now();
+            path = &logicServer.runAlgorithm().second;
+        } else {
+            const auto& query = workload.buildingQueries[i - blockQueries];
+            start = std::chrono::steady_clock::now();
+            path = &logicServer.findRoute(buildingCells[query.first], buildingCells[query.second]).second;
+        }
+        auto end = std::chrono::steady_clock::now();
+        elapsedNs += std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+        SearchStats stats = logicServer.getLastStats();
+        total.expansions += stats.expansions;
+        total.heapPushes += stats.heapPushes;
+        total.heapPops += stats.heapPops;
+        total.decreaseKeys += stats.decreaseKeys;
+        totalPath += path->size();
+    }
+    double queries = blockQueries + workload.buildingQueries.size();
+
+    Measurement measurement;
+    measurement.workload = workload.name;
+    measurement.kind = workload.kind;
+    measurement.algorithm = AlgorithmFactory::getAlgorithmName(type);
+    measurement.rows = workload.rows;
+    measurement.cols = workload.cols;
+    measurement.wallDensity = workload.wallDensity;
+    measurement.queries = blockQueries + workload.buildingQueries.size();
+    measurement.nsPerQuery = elapsedNs / queries;
+    measurement.expansionsPerSecond = elapsedNs > 0 ? total.expansions * 1e9 / elapsedNs : 0;
+    measurement.expansionsPerQuery = total.expansions / queries;
+    measurement.heapPushesPerQuery = total.heapPushes / queries;
+    measurement.heapPopsPerQuery = total.heapPops / queries;
+    measurement.decreaseKeysPerQuery = total.decreaseKeys / queries;
+    // the allocation counters also see the result vectors, which are reused from the workspace once warm
+    measurement.allocationsPerQuery = (allocationCount - allocationsBefore) / queries;
+    measurement.allocatedBytesPerQuery = (allocatedBytes - bytesBefore) / queries;
+    measurement.pathLengthPerQuery = totalPath / queries;
+    measurement.peakRssKb = peakRssKb();
+    return measurement;
+}
+
+/**
+* Writes the measurements as JSON.
+* @param path: the file to write.
+* @param measurements: the measurements.
+* @return true if the file was written.
+*/
+static bool writeJson(const std::string& path, const std::vector<Measurement>& measurements) {
+    std::ofstream out(path);
+    if(!out) {
+        return false;
+    }
+    out << "{\n  \"benchmark\": \"naviBench\",\n  \"results\": [\n";
+    for(size_t i = 0; i < measurements.size(); i++) {
+        const Measurement& m = measurements[i];
+        out << "    {\"workload\": \"" << m.workload << "\", \"kind\": \"" << m.kind
+            << "\", \"algorithm\": \"" << m.algorithm << "\", \"rows\": " << m.rows << ", \"cols\": " << m.cols
+            << ", \"wall_density\": " << m.wallDensity << ", \"queries\": " << m.queries
+            << ", \"ns_per_query\": " << (long) m.nsPerQuery
+            << ", \"expansions_per_sec\": " << (long) m.expansionsPerSecond
+            << ", \"expansions_per_query\": " << m.expansionsPerQuery
+            << ", \"heap_pushes_per_query\": " << m.heapPushesPerQuery
+            << ", \"heap_pops_per_query\": " << m.heapPopsPerQuery
+            << ", \"decrease_keys_per_query\": " << m.decreaseKeysPerQuery
+            << ", \"allocations_per_query\": " << m.allocationsPerQuery
+            << ", \"allocated_bytes_per_query\": " << (long) m.allocatedBytesPerQuery
+            << ", \"path_length_per_query\": " << m.pathLengthPerQuery
+            << ", \"peak_rss_kb\": " << m.peakRssKb << "}"
+            << (i + 1 < measurements.size() ? ",\n" : "\n");
+    }
+    out << "  ]\n}\n";
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    std::string jsonPath = "bench.json";
+    int queriesPerMap = 200;
+    bool checkAllocations = false;
+    for(int i = 1; i < argc; i++) {
+        if(std::strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            jsonPath = argv[++i];
+        } else if(std::strcmp(argv[i], "--queries") == 0 && i + 1 < argc) {
+            queriesPerMap = std::max(1, std::atoi(argv[++i]));
+        } else if(std::strcmp(argv[i], "--check-allocations") == 0) {
+            checkAllocations = true;
+        } else {
+            std::fprintf(stderr, "usage: %s [--json file] [--queries n] [--check-allocations]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    std::vector<Measurement> measurements;
+    int allocatingRuns = 0;
+    std::printf("%-14s %-9s %8s %12s %14s %10s %10s %9s %10s %10s\n", "map", "algorithm", "queries", "ns/query",
+                "expansions/s", "exp/query", "heap ops", "dec-keys", "allocs/q", "peak KB");
+    for(const Workload& workload: createWorkloads(queriesPerMap)) {
+        for(int type = 0; type < AlgorithmFactory::ALGORITHM_COUNT; type++) {
+            Measurement m = runWorkload(workload, type);
+            std::printf("%-14s %-9s %8ld %12.0f %14.0f %10.1f %10.1f %9.1f %10.1f %10ld\n", m.workload.c_str(), m.algorithm.c_str(),
+                        m.queries, m.nsPerQuery, m.expansionsPerSecond, m.expansionsPerQuery,
+                        m.heapPushesPerQuery + m.heapPopsPerQuery, m.decreaseKeysPerQuery, m.allocationsPerQuery, m.peakRssKb);
+            measurements.push_back(m);
+            if(m.allocationsPerQuery > 0) {
+                allocatingRuns++;
+            }
+        }
+    }
+    if(!writeJson(jsonPath, measurements)) {
+        std::fprintf(stderr, "could not write %s\n", jsonPath.c_str());
+        return 1;
+    }
+    std::printf("wrote %s\n", jsonPath.c_str());
+    if(checkAllocations && allocatingRuns > 0) {
+        std::fprintf(stderr, "%d runs allocated memory in warm queries\n", allocatingRuns);
+        return 1;
+    }
+    return 0;
+}
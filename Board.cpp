@@ -5,19 +5,93 @@
 */
 
 #include "Board.h"
+#include <utility>
+#include "RouteCache.h"
 
 void Board::initCampusMap() {
    campusMap = LevelMap(1);
 }
 
+/**
+* This will create an open custom map and switch the board to it.
+* @brief: This will create a custom map of the given size.
+* @param rows: the number of rows of the map.
+* @param cols: the number of columns of the map.
+*/
+void Board::initCustomMap(int rows, int cols) {
+   customMap = LevelMap(rows, cols);
+   setBoardMapType(2);
+}
+
+/**
+* This will read a custom map from text and switch the board to it.
+* Every line is a row of the map: '#' is a wall, '.' is open and a digit 1-9 is an open block of that weight.
+* Empty lines and lines starting with ';' are skipped. The start is the first open block and the target the last.
+* @brief: This will load a custom map from a text map.
+* @param in: the text map.
+* @return true if the map was loaded, false if it is empty, ragged or has an unknown character.
+*/
+bool Board::loadCustomMap(std::istream& in) {
+   std::vector<std::string> lines;
+   std::string line;
+   while(std::getline(in, line)) {
+       if(!line.empty() && line.back() == '\r') {
+           line.pop_back();
+       }
+       if(line.empty() || line[0] == ';') {
+           continue;
+       }
+       if(!lines.empty() && line.size() != lines[0].size()) {
+           return false;
+       }
+       lines.push_back(line);
+   }
+   if(lines.empty()) {
+       return false;
+   }
+   for(const std::string& row: lines) {
+       for(char c: row) {
+           if(c != '#' && c != '.' && (c < '1' || c > '9')) {
+               return false;
+           }
+       }
+   }
+
+   initCustomMap(lines.size(), lines[0].size());
+   std::pair<int, int> first(-1, -1);
+   std::pair<int, int> last(-1, -1);
+   for(int row = 0; row < (int) lines.size(); row++) {
+       for(int col = 0; col < (int) lines[row].size(); col++) {
+           char c = lines[row][col];
+           if(c == '#') {
+               customMap.setBlockType(row, col, 5);
+               continue;
+           }
+           if(c != '.') {
+               customMap.setBlockWeight(row, col, c - '0');
+           }
+           if(first.first < 0) {
+               first = std::make_pair(row, col);
+           }
+           last = std::make_pair(row, col);
+       }
+   }
+   if(first.first >= 0) {
+       customMap.setStartPoint(first.first, first.second);
+       customMap.setTargetPoint(last.first, last.second);
+   }
+   return true;
+}
+
 /** 
 * This will get the map type.
 * @brief: This will return the map type
 * @returns: maptype 
 */
-int Board::getMapType(){
+int Board::getMapType() const {
    // 0 - classic map
    // 1 - campus map
+   // 2 - custom map
    return mapType;
 }
 
@@ -27,31 +101,36 @@ int Board::getMapType(){
 * @returns: classic or main map
 */
 LevelMap* Board::getMap() {
+   return const_cast<LevelMap*>(static_cast<const Board*>(this)->getMap());
+};
+
+/** 
+* This will get the main map for reading only
+* @brief: This will get the main map or the campus map without allowing changes.
+* @returns: classic or main map
+*/
+const LevelMap* Board::getMap() const {
    if(mapType == 0) {
        return &classicMap;
+   } else if(mapType == 2) {
+       return &customMap;
    } else {
        return &campusMap;
    }
-};
+}
 
 /**
 * This switches the map type from the campus map to the classic map.
+* The maps are kept as they are, searches keep their state apart from the maps.
 * @brief: This switches the map type.
 */
 void Board::switchMap(int type) {
    /*
     * type: 0 - classic
     *       1 - campus map
+    *       2 - custom map
     */
-   switch(type) {
-      case 0:
-         setBoardMapType(0);             
-         classicMap = LevelMap();
-         break;
-      case 1:
-         setBoardMapType(1);
-         campusMap = LevelMap(1);
-   }
+   setBoardMapType(type);
 }
 
 /**
@@ -64,37 +143,86 @@ void Board::setBoardMapType(int num) {
 
 /**
 * This will set the starting building map
-* @brief: this will set the starting map
+* @brief: this will set the starting map, pass it with std::move to hand it over without a copy
 */
 void Board::setStartBuildingMap(std::vector<LevelMap> buildingMap) {
-   startBuildingMap = buildingMap;
+   startBuildingMap = std::move(buildingMap);
 }
 
 /**
 * This will set the target building 
-* @brief: This will set the target building.
+* @brief: This will set the target building, pass it with std::move to hand it over without a copy.
 */
 
 void Board::setTargetBuildingMap(std::vector<LevelMap> buildingMap){
-   targetBuildingMap = buildingMap;
+   targetBuildingMap = std::move(buildingMap);
+}
+
+/**
+* This will get the start building
+* @brief: This will return the floors of the start building.
+* @returns: the start building map, owned by the board
+*/
+const std::vector<LevelMap>& Board::getStartBuildingMap() const {
+   return startBuildingMap;
 }
 
 /**
-* This vector will set the start building and the target building
-* @brief: This vector will set the start and the target buildings.
+* This will get the target building
+* @brief: This will return the floors of the target building.
+* @returns: the target building map, owned by the board
 */
-std::vector<std::vector<LevelMap>> Board::getBuildingMap(){
-   std::vector<std::vector<LevelMap>> vect{ startBuildingMap, targetBuildingMap };
-   return vect;
+const std::vector<LevelMap>& Board::getTargetBuildingMap() const {
+   return targetBuildingMap;
 }
 
 /**
 * This will change the block in the map
+* A new wall only makes the routes through it longer, so the cached routes that do not touch it
+* are kept for the edited map.
 * @brief: This will change the block in the map.
 */
 void Board::changeBlockInMap(int row, int col, int type) {
-   if(mapType == 0) {
-       Block* nodeToChange = classicMap.getNode(row, col);
-       nodeToChange->setType(type);
+   if(mapType == 0 || mapType == 2) {
+       LevelMap* map = getMap();
+       unsigned long long oldVersion = map->getVersion();
+       bool wasWall = map->getNode(row, col)->getType() == 5;
+       map->setBlockType(row, col, type);
+       if(!wasWall && type == 5) {
+           RouteCache::getInstance().blockCostIncreased(oldVersion, map->getVersion(), row, col);
+       }
    }
-}
\ No newline at end of file
+}
+
+/**
+* This will add up the memory of the board and every map it holds.
+* @brief: This will return the bytes used by the board.
+* @returns: bytes of the board, the classic, campus and custom maps and the building maps
+*/
+long Board::getMemoryBytes() {
+   long bytes = sizeof(Board) - 3 * sizeof(LevelMap) + getMapMemoryBytes(0) + getMapMemoryBytes(1) + getMapMemoryBytes(2);
+   for(std::vector<LevelMap>* buildingMaps: {&startBuildingMap, &targetBuildingMap}) {
+      bytes += (buildingMaps->capacity() - buildingMaps->size()) * sizeof(LevelMap);
+      for(LevelMap& buildingMap: *buildingMaps) {
+         bytes += buildingMap.getMemoryBytes();
+      }
+   }
+   return bytes;
+}
+
+/**
+* This will return the memory of one map of the board.
+* @brief: This will return the bytes used by a map.
+* @param type: 0 for the classic map, 1 for the campus map, 2 for the custom map.
+* @returns: bytes of the map, 0 for an unknown type
+*/
+long Board::getMapMemoryBytes(int type) {
+   if(type == 0) {
+      return classicMap.getMemoryBytes();
+   } else if(type == 1) {
+      return campusMap.getMemoryBytes();
+   } else if(type == 2) {
+      return customMap.getMemoryBytes();
+   }
+   return 0;
+}
@@ -7,9 +7,9 @@
 #ifndef BOARD_H
 #define BOARD_H
 #pragma once
+#include <istream>
 #include <string>
 #include <vector>
-#include <Wt/WContainerWidget.h>
 #include "LevelMap.h"
 
 class Board
@@ -22,22 +22,30 @@ class Board
             campusMap = LevelMap(1);
         }
         void initCampusMap();
+        void initCustomMap(int rows, int cols);
+        bool loadCustomMap(std::istream& in);
         void switchMap(int type);
         void setBoardMapType(int num);
-        int getMapType();
+        int getMapType() const;
         LevelMap* getMap();
+        const LevelMap* getMap() const;
         void changeBlockInMap(int row, int col, int type);
-        std::vector<std::vector<LevelMap>> getBuildingMap();
+        long getMemoryBytes();
+        long getMapMemoryBytes(int type);
+        const std::vector<LevelMap>& getStartBuildingMap() const;
+        const std::vector<LevelMap>& getTargetBuildingMap() const;
         void setStartBuildingMap(std::vector<LevelMap> buildingMap);
         void setTargetBuildingMap(std::vector<LevelMap> buildingMap);
 
     private:
-        // type 0 is classic map, type 1 is campus map
+        // type 0 is classic map, type 1 is campus map, type 2 is custom map
         int mapType;
         // this is the flat map for classic mode
         LevelMap classicMap;
         // this is the flat map for general campus map
         LevelMap campusMap;
+        // this is a map of any size, used by the benchmarks and tools
+        LevelMap customMap = LevelMap(0, 0);
         // this is the specific building map
         std::vector<LevelMap> startBuildingMap;
         // this is the specific building map
@@ -5,8 +5,11 @@
 and the methods that are used to initialize the map of buildings, their coordinates, and their entrance coordinates on the map grid.
 */
 #include "BuildingDictionary.h"
+#include <algorithm>
 #include <vector>
 #include <string>
+#include <utility>
+#include "LevelMap.h"
 
 /**
 @brief: This void function sets the blocks corresponding to each building on the building map and labels each vector of coordinates with the name of the building.
@@ -15,269 +18,371 @@ and the methods that are used to initialize the map of buildings, their coordina
 void BuildingDictionary::initializeMapBuildingLocations() {
     std::pair<int, int> entrance = {23, 74};
     std::vector<std::pair<int,int>> coordinates = {{23,64}, {22,64}, {21,65}, {20,65}, {19,65}, {19,66}, {19,67}, {20,67}, {20,68}, {21,69}, {21,70}, {22,71}, {23,72}, {24,74}, {23,74}, {23,75}, {24,75}, {24,76}, {24,77}, {25,77}, {25,78}, {25,79}, {26,79}, {26,80}, {27,79}, {28,79}, {28,78}, {29,78}, {30,78}, {30,77}, {31,77}, {31,76}, {30,76}, {30,75}, {29,75}, {29,74}, {28,73}, {28,72}, {27,72}, {27,71}, {26,71}, {26,70}, {25,70}, {25,69}, {25,68}, {24,68}, {24,67}, {23,67}, {23,66}, {23,65}, {22,65}, {24,66}, {25,67}, {26,68}, {26,69}, {27,69}, {27,70}, {22,66}, {23,68}, {23,69}, {24,69}, {24,70}, {24,71}, {25,71}, {25,72}, {28,76}, {29,76}, {29,77}, {28,77}, {27,78}, {26,78}, {26,77}, {27,77}, {27,76}, {28,75}, {28,74}, {27,73}, {26,72}, {26,73}, {26,74}, {26,75}, {26,76}, {25,76}, {25,75}, {25,74}, {27,75}, {27,74}, {25,73}, {24,73}, {24,72}, {23,70}, {23,71}, {22,70}, {22,69}, {22,68}, {22,67}, {21,67}, {21,68}, {21,66}, {20,66}, {21,64}, {24,65}, {28,71}, {29,73}};
-    BuildingInfo building = BuildingInfo("West Valley Building", coordinates, entrance);
-    buildings.push_back(building);
+    BuildingInfo building = BuildingInfo("West Valley Building", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {30, 59};
     coordinates = {{31,59}, {34,59}, {33,59}, {32,59}, {32,60}, {34,58}, {31,60}, {33,58}, {35,58}, {36,58}, {36,59}, {36,60}, {37,61}, {37,62}, {37,63}, {37,64}, {38,65}, {38,66}, {38,67}, {39,67}, {40,68}, {40,69}, {40,70}, {40,71}, {41,71}, {41,72}, {41,73}, {40,73}, {39,73}, {38,73}, {37,73}, {37,72}, {37,71}, {36,71}, {36,72}, {35,72}, {35,71}, {35,70}, {35,69}, {35,68}, {35,67}, {34,67}, {34,66}, {34,65}, {33,65}, {33,64}, {33,63}, {32,63}, {32,62}, {33,62}, {34,62}, {35,62}, {36,62}, {36,61}, {35,61}, {35,60}, {35,59}, {36,63}, {36,64}, {37,65}, {37,66}, {37,67}, {37,68}, {38,68}, {38,69}, {39,69}, {39,70}, {39,68}, {40,72}, {39,72}, {38,72}, {38,71}, {39,71}, {38,70}, {37,70}, {37,69}, {36,69}, {36,70}, {36,68}, {36,67}, {36,66}, {36,65}, {35,65}, {35,66}, {35,64}, {35,63}, {34,63}, {34,64}, {34,61}, {34,60}, {30,59}, {30,60}, {41,70}};
-    building = BuildingInfo("Siebens Centre", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("Siebens Centre", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance =  {34, 94};
     coordinates = {{28,81}, {29,81}, {29,80}, {30,80}, {28,82}, {28,83}, {29,82}, {29,83}, {29,84}, {30,81}, {30,82}, {30,83}, {30,84}, {30,85}, {31,85}, {32,85}, {33,85}, {34,85}, {29,85}, {31,80}, {31,81}, {31,82}, {31,83}, {31,84}, {32,81}, {32,82}, {32,83}, {32,84}, {33,83}, {33,84}, {33,82}, {31,86}, {32,86}, {33,86}, {34,86}, {35,86}, {36,86}, {30,87}, {31,87}, {32,87}, {33,87}, {34,87}, {35,87}, {36,87}, {37,87}, {29,88}, {30,88}, {31,88}, {32,88}, {33,88}, {34,88}, {35,88}, {36,88}, {37,88}, {37,89}, {29,87}, {34,84}, {35,85}, {30,89}, {31,89}, {32,89}, {33,89}, {34,89}, {35,89}, {36,89}, {37,90}, {38,90}, {39,90}, {40,90}, {41,90}, {42,90}, {43,90}, {44,90}, {38,89}, {39,89}, {40,89}, {41,89}, {42,89}, {43,89}, {44,89}, {45,89}, {45,90}, {46,90}, {32,93}, {33,93}, {33,94}, {34,94}, {34,95}, {30,90}, {31,90}, {33,90}, {34,90}, {35,90}, {36,90}, {31,91}, {32,91}, {32,92}, {32,90}, {33,91}, {33,92}, {34,93}, {34,92}, {34,91}, {35,92}, {36,92}, {37,92}, {35,91}, {36,91}, {37,91}, {38,91}, {39,91}, {41,91}, {42,91}, {43,91}, {40,91}, {39,92}, {39,93}, {40,92}, {40,93}, {35,94}, {35,93}, {36,93}, {46,89}, {47,89}, {48,89}, {49,89}, {50,89}, {44,91}, {45,91}, {46,91}, {47,91}, {48,91}, {49,91}, {47,90}, {48,90}, {49,90}, {50,90}, {51,90}, {50,91}, {51,91}, {52,91}};
-    building = BuildingInfo("Dental Sciences", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("Dental Sciences", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {48,77};
     coordinates = {{60,80}, {60,81}, {59,81}, {59,82}, {58,82}, {57,83}, {56,83}, {56,84}, {58,81}, {57,82}, {53,90}, {53,89}, {52,89}, {52,88}, {52,87}, {51,87}, {51,86}, {51,85}, {50,85}, {50,84}, {50,83}, {50,82}, {49,82}, {49,81}, {49,80}, {49,79}, {48,79}, {48,78}, {48,77}, {49,77}, {49,78}, {50,76}, {50,77}, {50,78}, {50,79}, {50,80}, {50,81}, {51,76}, {51,77}, {51,78}, {51,79}, {51,80}, {51,81}, {51,82}, {51,83}, {51,84}, {51,75}, {49,76}, {49,83}, {48,80}, {48,81}, {52,77}, {52,78}, {52,79}, {52,80}, {52,81}, {52,82}, {52,83}, {52,84}, {53,84}, {53,85}, {53,86}, {53,87}, {53,88}, {52,86}, {52,85}, {53,79}, {53,80}, {53,81}, {53,82}, {53,83}, {54,81}, {54,82}, {54,83}, {54,84}, {54,85}, {54,86}, {54,87}, {54,88}, {54,89}, {55,82}, {55,83}, {55,84}, {55,85}, {55,86}, {55,87}, {55,88}, {55,89}, {54,80}, {53,78}, {61,81}, {61,82}, {60,82}, {60,83}, {59,83}, {58,84}, {57,84}, {58,83}, {59,80}, {57,85}, {56,86}, {56,87}, {56,85}, {58,87}, {57,87}, {57,86}, {57,88}, {56,88}, {56,89}, {47,78}};
-    building = BuildingInfo("Medical Sciences", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("Medical Sciences", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {59,78};
     coordinates = {{54,72}, {55,73}, {55,74}, {55,75}, {54,73}, {54,74}, {54,75}, {55,72}, {56,74}, {56,75}, {56,76}, {56,77}, {57,76}, {57,77}, {57,78}, {57,79}, {57,81}, {57,80}, {55,77}, {55,76}, {53,74}, {53,73}, {57,75}, {58,77}, {58,78}, {58,79}, {58,80}, {56,78}, {59,79}, {59,80}, {58,81}};
-    building = BuildingInfo("Clinical Skills", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("Clinical Skills", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {49,99};
     coordinates = {{49,93}, {48,93}, {47,93}, {46,93}, {49,94}, {48,94}, {47,94}, {46,94}, {45,94}, {49,95}, {46,95}, {45,95}, {48,95}, {47,95}, {50,96}, {49,96}, {48,96}, {47,96}, {46,96}, {45,96}, {47,97}, {47,98}, {47,99}, {47,100}, {49,99}, {48,99}, {49,100}, {48,100}, {46,100}, {45,100}, {44,100}, {43,100}, {46,99}, {45,99}, {44,99}, {43,99}, {46,98}, {45,98}, {44,98}, {43,98}, {46,97}, {45,97}, {44,97}, {43,97}, {43,94}, {43,95}, {43,96}, {42,100}, {42,99}, {42,98}, {42,97}, {42,96}, {42,95}, {42,94}, {42,93}, {45,93}, {44,93}, {43,93}, {44,94}, {44,95}, {44,96}};
-    building = BuildingInfo("Health Sciences Addition", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("Health Sciences Addition", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {60,105};
     coordinates = {{56,106}, {56,105}, {56,104}, {56,103}, {55,105}, {54,105}, {53,105}, {54,106}, {55,106}, {57,106}, {52,105}, {55,104}, {54,104}, {52,104}, {52,103}, {52,106}, {53,106}, {53,107}, {53,108}, {53,103}, {53,104}, {52,102}, {53,102}, {52,101}, {54,102}, {55,102}, {54,103}, {55,103}, {57,103}, {57,102}, {56,102}, {54,101}, {55,101}, {56,101}, {57,101}, {58,101}, {59,101}, {59,102}, {60,102}, {60,103}, {60,104}, {60,105}, {60,106}, {59,106}, {59,107}, {60,107}, {60,108}, {59,108}, {59,109}, {58,109}, {57,109}, {56,109}, {55,109}, {54,109}, {54,110}, {55,110}, {53,109}, {54,108}, {54,107}, {55,107}, {56,107}, {57,107}, {57,108}, {56,108}, {55,108}, {58,108}, {58,107}, {58,106}, {58,105}, {59,105}, {59,104}, {59,103}, {58,103}, {58,102}, {58,104}, {57,105}, {57,104}, {60,101}, {54,100}, {55,100}, {59,100}, {58,100}, {57,100}, {56,100}, {60,100}};
-    building = BuildingInfo("Natural Science", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("Natural Science", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {51,102};
     coordinates = {{52,105}, {52,104}, {52,103}, {52,102}, {51,103}, {52,106}, {51,106}, {50,106}, {49,106}, {48,106}, {48,107}, {48,108}, {47,108}, {46,108}, {45,108}, {44,108}, {43,108}, {42,108}, {41,108}, {40,108}, {40,107}, {41,107}, {41,106}, {40,106}, {41,105}, {41,104}, {41,103}, {40,103}, {41,102}, {42,102}, {43,102}, {44,102}, {45,102}, {46,102}, {47,102}, {48,102}, {49,102}, {50,102}, {51,102}, {51,104}, {51,105}, {50,105}, {50,104}, {50,103}, {49,103}, {49,104}, {49,105}, {48,105}, {48,104}, {48,103}, {47,103}, {47,104}, {47,105}, {47,106}, {47,107}, {46,107}, {46,106}, {46,105}, {46,104}, {46,103}, {45,103}, {45,104}, {44,105}, {44,106}, {44,107}, {45,107}, {45,106}, {45,105}, {44,104}, {44,103}, {43,103}, {42,103}, {42,104}, {42,105}, {42,106}, {42,107}, {43,107}, {43,106}, {43,105}, {43,104}, {41,109}, {42,109}, {43,109}, {44,109}, {45,109}, {46,109}, {47,109}, {48,109}, {40,105}, {40,104}, {49,107}, {50,107}, {51,107}, {52,107}};
-    building = BuildingInfo("Taylor Library", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("Taylor Library", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {55,93};
     coordinates = {{58,88}, {58,89}, {58,90}, {58,91}, {58,92}, {58,93}, {58,94}, {58,95}, {57,88}, {57,89}, {57,90}, {57,91}, {57,92}, {57,93}, {57,94}, {57,95}, {57,96}, {60,94}, {60,95}, {60,96}, {59,94}, {58,96}, {59,96}, {59,95}, {56,96}, {55,96}, {55,95}, {55,94}, {56,95}, {56,94}, {56,93}, {56,92}, {56,91}, {56,90}, {56,89}, {58,87}};
-    building = BuildingInfo("Kresge", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("Kresge", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {77,82};
     coordinates = {{83,81}, {82,79}, {81,79}, {79,81}, {78,81}, {77,81}, {77,82}, {76,81}, {79,80}, {80,80}, {81,80}, {80,79}, {80,81}, {80,82}, {81,82}, {81,83}, {81,84}, {82,84}, {82,85}, {83,85}, {83,86}, {82,86}, {82,87}, {81,87}, {81,88}, {81,86}, {80,87}, {80,88}, {79,87}, {81,89}, {82,89}, {83,89}, {83,88}, {82,88}, {83,87}, {82,83}, {83,83}, {83,82}, {84,82}, {84,81}, {85,81}, {85,80}, {84,80}, {82,81}, {82,82}, {81,81}, {78,82}, {76,82}, {82,80}, {83,80}, {84,79}, {83,79}, {83,78}, {84,78}, {84,77}, {85,79}, {86,81}, {85,82}, {82,78}};
-    building = BuildingInfo("Stevenson Hall", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("Stevenson Hall", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {86,75};
     coordinates = {{93,76}, {93,75}, {92,75}, {92,74}, {91,73}, {91,72}, {90,72}, {90,73}, {89,73}, {89,74}, {88,74}, {87,74}, {87,75}, {86,75}, {85,75}, {85,76}, {84,76}, {85,77}, {85,78}, {86,79}, {87,81}, {88,80}, {88,79}, {89,79}, {89,78}, {90,78}, {91,78}, {91,77}, {92,77}, {93,77}, {94,76}, {93,74}, {93,73}, {92,73}, {92,72}, {90,74}, {88,75}, {88,76}, {87,76}, {89,76}, {89,75}, {90,75}, {91,75}, {91,74}, {91,76}, {92,76}, {90,76}, {90,77}, {89,77}, {88,77}, {87,77}, {87,78}, {87,79}, {88,78}, {86,78}, {86,77}, {86,76}, {87,80}, {86,80}};
-    building = BuildingInfo("Lawson Hall", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("Lawson Hall", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {95,85};
     coordinates = {{97,90}, {97,89}, {98,88}, {100,87}, {100,86}, {101,86}, {100,85}, {99,85}, {99,86}, {98,86}, {97,86}, {96,86}, {95,86}, {95,87}, {94,87}, {93,88}, {94,88}, {95,88}, {96,88}, {96,87}, {97,87}, {98,85}, {99,87}, {98,87}, {97,88}, {96,89}, {99,88}, {101,87}, {102,87}, {102,86}, {101,85}, {100,84}, {100,83}, {100,82}, {99,82}, {99,81}, {98,81}, {98,82}, {97,82}, {97,83}, {97,84}, {97,85}, {96,85}, {95,85}, {94,86}, {93,87}, {92,88}, {91,88}, {90,88}, {90,89}, {89,89}, {98,84}, {99,83}, {98,83}, {99,84}, {95,89}, {94,90}, {93,90}, {93,91}, {92,91}, {91,91}, {92,92}, {92,93}, {91,93}, {91,92}, {90,92}, {89,92}, {89,93}, {88,93}, {87,93}, {87,94}, {86,94}, {85,94}, {85,95}, {86,95}, {86,96}, {85,96}, {84,96}, {84,95}, {84,94}, {83,94}, {84,93}, {85,93}, {85,92}, {86,92}, {87,92}, {88,92}, {86,93}, {87,91}, {88,91}, {89,91}, {89,90}, {90,90}, {91,90}, {92,90}, {93,89}, {94,89}, {92,89}, {91,89}, {90,91}, {93,86}, {92,87}, {91,87}, {90,87}, {90,86}, {90,85}, {89,85}, {89,84}, {88,85}, {87,85}, {87,86}, {86,86}, {86,87}, {87,87}, {88,86}, {87,88}, {88,88}, {88,89}, {89,88}, {88,87}, {89,87}, {89,86}, {101,84}, {101,83}, {96,84}};
-    building = BuildingInfo("University College", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("University College", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {98,68};
     coordinates = {{110,66}, {111,67}, {111,68}, {112,68}, {112,69}, {112,70}, {112,71}, {113,71}, {113,72}, {110,65}, {111,66}, {109,66}, {109,67}, {109,68}, {109,69}, {109,70}, {109,71}, {109,72}, {109,73}, {109,74}, {109,75}, {108,75}, {108,74}, {108,73}, {108,72}, {108,71}, {108,70}, {108,69}, {108,68}, {108,67}, {108,66}, {107,67}, {107,68}, {107,69}, {107,70}, {107,71}, {110,67}, {110,68}, {110,69}, {110,70}, {110,71}, {110,72}, {110,73}, {110,74}, {111,69}, {111,70}, {111,71}, {111,72}, {111,73}, {111,74}, {112,72}, {112,73}, {113,73}, {106,68}, {105,68}, {104,68}, {103,68}, {102,69}, {106,69}, {105,69}, {104,69}, {103,69}, {106,70}, {105,70}, {104,70}, {103,70}, {102,70}, {101,70}, {100,70}, {99,70}, {98,70}, {101,69}, {100,69}, {99,69}, {98,69}, {97,69}, {103,65}, {103,66}, {104,66}, {104,67}, {105,67}, {106,67}, {103,67}, {103,71}, {103,72}, {102,66}, {102,67}, {102,68}, {102,71}, {102,72}, {102,73}, {101,73}, {101,72}, {101,71}, {101,67}, {100,67}, {100,71}, {100,72}, {100,73}, {99,67}, {99,71}, {101,68}, {100,68}, {99,68}, {98,68}, {101,66}, {102,65}, {98,71}, {97,68}, {104,71}, {99,72}};
-    building = BuildingInfo("Somerville House", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("Somerville House", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {118,69};
     coordinates = {{111,65}, {111,66}, {112,66}, {112,67}, {112,68}, {113,68}, {113,69}, {113,70}, {113,71}, {114,71}, {114,72}, {114,73}, {114,70}, {114,69}, {114,68}, {113,64}, {113,65}, {113,66}, {113,67}, {112,64}, {112,65}, {114,65}, {114,66}, {114,67}, {115,66}, {115,67}, {115,68}, {115,69}, {115,70}, {115,71}, {115,72}, {116,67}, {116,68}, {116,69}, {116,70}, {116,71}, {117,67}, {117,68}, {117,69}, {117,70}, {118,67}, {118,68}, {118,69}, {118,70}, {117,71}, {118,71}, {119,70}, {116,72}, {119,67}, {119,68}, {118,66}, {117,66}};
-    building = BuildingInfo("3M Centre", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("3M Centre", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {113,59};
     coordinates = {{120,67}, {120,66}, {120,65}, {120,64}, {119,66}, {119,65}, {119,64}, {119,63}, {118,64}, {118,63}, {118,62}, {118,61}, {118,60}, {117,64}, {117,63}, {117,62}, {117,61}, {117,60}, {116,65}, {116,64}, {116,63}, {116,62}, {116,61}, {116,60}, {116,59}, {113,63}, {113,62}, {113,61}, {113,60}, {113,59}, {114,63}, {114,62}, {114,61}, {114,60}, {114,59}, {114,64}, {115,65}, {115,64}, {115,63}, {115,62}, {115,61}, {115,60}, {115,59}, {121,66}, {121,65}, {121,64}, {121,63}, {121,62}, {121,61}, {121,60}, {121,59}, {121,58}, {121,57}, {121,56}, {121,55}, {120,57}, {120,58}, {120,59}, {120,60}, {120,61}, {120,62}, {119,62}, {120,63}, {119,61}, {119,60}, {119,59}, {119,58}, {119,57}, {119,56}, {120,56}, {118,59}, {118,58}, {118,57}, {117,59}, {117,58}, {116,58}, {117,57}, {122,55}, {122,56}, {122,57}, {122,58}, {122,59}, {122,60}, {122,61}, {122,62}, {122,63}, {122,64}, {122,65}, {122,66}, {121,67}, {123,58}, {123,59}, {123,60}, {123,61}, {123,62}, {123,63}, {123,64}, {123,65}, {123,66}, {124,65}, {124,64}, {124,63}, {124,62}, {124,61}, {124,60}, {124,59}, {125,61}, {125,62}, {125,65}, {125,60}, {124,58}, {123,57}, {123,56}, {115,58}};
-    building = BuildingInfo("Thames Hall", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("Thames Hall", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {68,73};
     coordinates = {{77,66}, {77,65}, {76,65}, {76,66}, {75,66}, {74,67}, {73,67}, {72,67}, {72,68}, {71,68}, {70,68}, {70,69}, {71,69}, {74,66}, {78,66}, {79,66}, {79,67}, {79,68}, {78,68}, {77,68}, {78,67}, {77,67}, {76,67}, {75,67}, {75,68}, {74,68}, {73,68}, {74,69}, {75,69}, {76,68}, {76,69}, {74,70}, {73,70}, {72,70}, {72,71}, {71,71}, {71,72}, {70,73}, {70,72}, {69,73}, {68,73}, {67,73}, {67,74}, {66,74}, {66,73}, {66,72}, {67,72}, {68,72}, {69,72}, {70,71}, {71,70}, {72,69}, {73,69}, {78,69}, {79,69}, {71,67}, {69,69}, {69,68}, {69,67}, {69,66}, {68,64}, {67,64}, {67,63}, {66,64}, {66,65}, {66,66}, {66,67}, {67,67}, {67,68}, {68,69}, {68,70}, {69,70}, {70,70}, {69,71}, {68,71}, {67,71}, {66,71}, {67,70}, {67,69}, {68,67}, {68,66}, {68,68}, {67,66}, {67,65}, {68,65}, {69,65}, {70,54}, {69,55}, {68,56}, {68,55}, {71,54}, {69,54}, {67,56}, {67,57}, {66,57}, {66,58}, {66,59}, {65,59}, {64,59}, {64,60}, {63,61}, {63,60}, {63,62}, {62,62}, {61,62}, {62,61}, {60,62}, {60,63}, {59,63}, {59,64}, {60,64}, {60,65}, {59,65}, {59,66}, {60,66}, {60,67}, {60,68}, {60,69}, {61,69}, {61,70}, {62,70}, {62,69}, {62,68}, {63,68}, {64,68}, {64,67}, {65,67}, {66,68}, {66,69}, {66,70}, {65,70}, {65,69}, {65,68}, {70,55}, {71,56}, {71,57}, {70,57}, {70,58}, {69,58}, {68,58}, {68,59}, {70,56}, {69,56}, {69,57}, {68,57}, {67,58}, {67,55}, {67,59}, {66,60}, {65,61}, {66,61}, {67,60}, {66,62}, {65,62}, {65,63}, {66,63}, {64,64}, {65,65}, {63,67}, {64,65}, {65,66}, {62,67}, {61,68}, {61,67}, {61,66}, {62,65}, {62,64}, {61,64}, {61,63}, {61,65}, {62,66}, {63,66}, {64,66}, {65,64}, {63,65}, {63,64}, {63,63}, {62,63}, {64,63}, {64,62}, {64,61}, {65,60}, {61,61}, {80,68}, {80,67}, {66,56}, {67,61}, {68,63}, {69,64}, {59,62}, {62,60}};
-    building = BuildingInfo("Social Sciences", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("Social Sciences", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {78,50};
     coordinates = {{83,46}, {83,45}, {82,45}, {80,47}, {79,47}, {79,46}, {80,46}, {81,46}, {82,46}, {78,46}, {78,45}, {78,44}, {78,43}, {77,43}, {77,42}, {77,41}, {76,41}, {76,40}, {76,39}, {75,39}, {75,40}, {74,40}, {74,41}, {73,41}, {72,41}, {72,40}, {71,41}, {70,41}, {71,40}, {70,40}, {69,40}, {68,40}, {68,41}, {67,41}, {66,41}, {66,42}, {67,42}, {67,43}, {67,44}, {67,45}, {67,46}, {68,46}, {68,47}, {68,48}, {68,49}, {69,49}, {69,50}, {69,51}, {70,52}, {70,53}, {71,53}, {71,54}, {71,55}, {72,55}, {72,56}, {72,57}, {73,57}, {73,58}, {74,58}, {74,59}, {75,59}, {76,59}, {77,59}, {77,58}, {78,58}, {78,57}, {79,57}, {79,56}, {79,55}, {78,55}, {78,54}, {78,53}, {78,52}, {78,51}, {78,50}, {78,49}, {79,49}, {79,50}, {80,50}, {81,50}, {81,49}, {80,49}, {80,48}, {81,48}, {82,48}, {82,47}, {84,46}, {84,45}, {83,47}, {81,47}, {80,45}, {79,45}, {79,44}, {81,45}, {83,44}, {82,44}, {84,44}, {85,45}, {85,46}, {84,47}, {83,48}, {82,49}, {78,42}, {73,40}, {76,45}, {77,45}, {77,44}, {76,44}, {76,43}, {76,42}, {75,41}, {76,50}, {77,50}, {77,51}, {77,53}, {77,56}, {78,56}, {77,57}, {76,58}, {75,58}, {74,57}, {74,56}, {74,55}, {75,56}, {75,57}, {76,57}, {76,55}, {77,52}, {77,54}, {77,55}, {76,56}, {73,56}, {73,55}, {74,54}, {74,53}, {75,53}, {75,54}, {75,55}, {76,54}, {76,53}, {76,52}, {76,49}, {77,49}, {77,48}, {78,48}, {79,48}, {78,47}, {77,46}, {76,46}, {75,45}, {74,44}, {74,43}, {74,42}, {75,42}, {75,43}, {75,44}, {75,46}, {75,47}, {75,48}, {76,48}, {76,47}, {77,47}, {75,50}, {75,51}, {75,52}, {76,51}, {73,54}, {72,54}, {72,53}, {73,53}, {74,52}, {75,49}, {73,52}, {73,51}, {73,50}, {73,49}, {74,49}, {74,47}, {74,45}, {74,46}, {74,48}, {74,50}, {74,51}, {73,44}, {73,43}, {73,42}, {73,45}, {73,46}, {73,47}, {73,48}, {72,51}, {72,50}, {72,49}, {72,48}, {72,47}, {72,46}, {72,45}, {72,44}, {72,43}, {72,42}, {71,43}, {71,44}, {71,45}, {71,46}, {71,49}, {71,52}, {72,52}, {71,51}, {71,50}, {71,48}, {71,47}, {71,42}, {70,42}, {69,41}, {69,42}, {69,43}, {68,43}, {68,42}, {68,44}, {68,45}, {69,46}, {69,47}, {69,48}, {70,49}, {70,50}, {70,51}, {70,48}, {70,47}, {70,46}, {70,45}, {70,44}, {70,43}, {69,44}, {69,45}, {67,40}};
-    building = BuildingInfo("University Community Centre", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("University Community Centre", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {82,36};
     coordinates = {{85,37}, {85,38}, {84,38}, {83,39}, {83,40}, {82,40}, {81,40}, {80,40}, {79,41}, {78,40}, {78,39}, {78,38}, {77,38}, {77,39}, {79,39}, {77,40}, {79,40}, {83,38}, {85,36}, {84,37}, {83,37}, {82,37}, {82,38}, {82,39}, {81,39}, {81,38}, {81,37}, {80,37}, {80,38}, {79,38}, {79,37}, {78,37}, {80,39}, {86,37}, {86,36}, {76,38}};
-    building = BuildingInfo("Western Student Services", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("Western Student Services", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {86,49};
     coordinates = {{101,45}, {103,45}, {102,45}, {103,46}, {105,47}, {106,47}, {105,46}, {104,46}, {106,48}, {105,49}, {105,50}, {105,48}, {104,48}, {103,48}, {102,49}, {101,49}, {100,50}, {101,50}, {102,50}, {103,49}, {104,49}, {104,50}, {103,47}, {102,47}, {102,46}, {101,46}, {101,47}, {100,47}, {100,46}, {99,45}, {99,46}, {98,45}, {98,44}, {99,44}, {98,43}, {97,43}, {96,43}, {95,43}, {94,42}, {93,42}, {92,42}, {92,41}, {91,41}, {91,42}, {91,43}, {90,43}, {90,44}, {89,44}, {88,44}, {87,45}, {87,46}, {87,47}, {87,48}, {86,49}, {86,50}, {86,51}, {85,51}, {85,52}, {86,52}, {87,52}, {88,52}, {89,52}, {89,53}, {90,53}, {91,53}, {90,54}, {90,55}, {89,55}, {90,56}, {90,57}, {91,57}, {91,58}, {90,58}, {92,58}, {92,59}, {92,60}, {91,60}, {91,61}, {92,61}, {93,61}, {93,60}, {94,60}, {94,59}, {95,59}, {96,59}, {97,59}, {99,58}, {99,57}, {100,57}, {101,57}, {101,56}, {100,56}, {98,58}, {97,58}, {96,58}, {102,56}, {102,55}, {103,55}, {103,54}, {102,54}, {102,53}, {103,53}, {101,53}, {101,52}, {102,52}, {102,51}, {103,51}, {103,50}, {104,47}, {102,48}, {101,48}, {100,49}, {99,51}, {98,52}, {97,53}, {96,53}, {95,54}, {97,52}, {97,51}, {98,51}, {99,50}, {99,49}, {99,47}, {99,52}, {101,54}, {100,52}, {100,48}, {100,51}, {101,55}, {99,56}, {98,56}, {96,56}, {95,56}, {97,55}, {98,55}, {99,54}, {100,54}, {100,53}, {101,51}, {99,55}, {99,53}, {98,53}, {97,54}, {96,55}, {98,54}, {96,52}, {95,52}, {95,51}, {95,50}, {96,49}, {96,48}, {98,47}, {99,48}, {98,48}, {97,48}, {97,49}, {96,50}, {96,51}, {97,50}, {98,49}, {98,50}, {100,55}, {97,56}, {96,57}, {97,57}, {98,57}, {95,58}, {94,58}, {93,59}, {94,57}, {95,55}, {96,54}, {95,57}, {95,53}, {94,54}, {94,55}, {93,57}, {94,56}, {93,54}, {93,55}, {93,56}, {93,58}, {92,57}, {92,56}, {92,55}, {91,54}, {91,51}, {91,50}, {91,49}, {90,49}, {89,49}, {89,50}, {88,50}, {87,51}, {88,51}, {89,51}, {90,51}, {90,52}, {91,52}, {91,55}, {91,56}, {92,52}, {92,51}, {93,50}, {94,49}, {95,48}, {96,47}, {95,49}, {94,50}, {94,51}, {94,52}, {94,53}, {93,53}, {92,54}, {93,52}, {93,51}, {97,47}, {97,46}, {97,45}, {97,44}, {96,44}, {95,44}, {94,44}, {94,43}, {93,43}, {92,43}, {92,44}, {92,45}, {91,45}, {91,46}, {90,46}, {89,47}, {88,47}, {88,46}, {89,46}, {88,48}, {88,49}, {87,50}, {87,49}, {88,45}, {89,45}, {90,45}, {91,44}, {93,44}, {93,45}, {92,46}, {91,47}, {90,48}, {90,50}, {90,47}, {89,48}, {92,53}, {92,50}, {92,49}, {95,46}, {96,45}, {96,46}, {98,46}, {94,46}, {94,47}, {93,47}, {93,48}, {93,49}, {94,48}, {92,48}, {94,45}, {93,46}, {91,48}, {92,47}, {95,45}, {95,47}, {88,53}};
-    building = BuildingInfo("Weldon Library", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("Weldon Library", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {111,32};
     coordinates = {{113,32}, {113,33}, {113,34}, {113,35}, {113,36}, {112,36}, {112,37}, {112,38}, {117,29}, {117,30}, {117,31}, {117,32}, {117,33}, {117,34}, {117,35}, {117,36}, {117,37}, {116,29}, {116,30}, {116,31}, {116,32}, {116,33}, {116,34}, {116,35}, {116,36}, {116,37}, {115,37}, {114,37}, {113,37}, {111,37}, {110,37}, {110,38}, {110,39}, {111,38}, {110,35}, {110,34}, {110,33}, {110,32}, {110,36}, {111,36}, {111,35}, {111,34}, {111,33}, {112,35}, {112,34}, {112,33}, {112,32}, {113,31}, {114,31}, {115,31}, {115,32}, {114,32}, {114,33}, {115,34}, {115,35}, {115,36}, {114,36}, {114,35}, {114,34}, {115,33}, {118,29}, {118,30}, {118,31}, {118,32}, {118,33}, {118,34}, {118,36}, {118,37}, {119,28}, {119,29}, {119,30}, {119,31}, {119,32}, {119,33}, {119,34}, {119,35}, {119,36}, {119,37}, {118,35}, {120,36}, {121,36}, {121,35}, {122,35}, {122,36}, {122,37}, {122,38}, {121,37}, {121,38}, {121,39}, {120,37}, {120,38}, {120,39}, {120,35}, {120,34}, {120,33}, {120,32}, {120,31}, {121,34}, {121,33}, {120,30}, {121,32}, {123,39}, {123,38}, {123,37}, {122,39}, {118,38}, {117,38}, {113,38}, {114,38}, {109,33}, {109,34}, {109,35}, {109,36}, {108,33}, {108,34}, {109,32}, {111,32}, {115,30}, {112,31}};
-    building = BuildingInfo("Law", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("Law", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {15,99};
     coordinates = {{31,95}, {32,95}, {33,95}, {33,96}, {32,94}, {31,94}, {30,94}, {29,94}, {28,94}, {27,94}, {26,94}, {25,94}, {25,95}, {32,96}, {31,96}, {30,96}, {29,96}, {28,96}, {27,96}, {26,96}, {25,96}, {24,96}, {29,95}, {28,95}, {27,95}, {26,95}, {24,95}, {23,95}, {22,95}, {21,95}, {20,95}, {19,95}, {18,95}, {17,95}, {17,96}, {30,95}, {27,101}, {26,101}, {25,101}, {24,101}, {23,101}, {22,101}, {21,101}, {19,101}, {18,101}, {20,101}, {20,103}, {20,102}, {21,103}, {21,102}, {25,100}, {25,99}, {25,98}, {25,97}, {25,93}, {24,93}, {24,94}, {24,97}, {24,98}, {24,99}, {24,100}, {23,93}, {23,94}, {23,96}, {23,97}, {23,98}, {23,99}, {23,100}, {22,93}, {22,94}, {22,96}, {22,97}, {22,98}, {22,99}, {22,100}, {22,92}, {23,92}, {24,92}, {25,92}, {21,88}, {21,89}, {21,90}, {21,91}, {21,92}, {21,93}, {21,94}, {21,96}, {21,97}, {21,98}, {21,99}, {21,100}, {18,100}, {18,99}, {18,98}, {18,97}, {18,96}, {18,94}, {18,93}, {18,92}, {18,91}, {19,91}, {19,90}, {18,90}, {18,89}, {18,88}, {18,87}, {18,86}, {19,86}, {19,87}, {19,88}, {19,89}, {19,92}, {19,93}, {19,94}, {19,96}, {19,97}, {19,98}, {19,99}, {19,100}, {20,100}, {20,99}, {20,98}, {20,97}, {20,96}, {20,94}, {20,93}, {20,92}, {20,91}, {20,90}, {20,89}, {20,88}, {22,88}, {22,87}, {21,87}, {20,87}, {22,89}, {17,86}, {16,86}, {15,86}, {14,86}, {13,86}, {17,87}, {16,87}, {15,87}, {14,87}, {13,87}, {10,88}, {11,88}, {12,88}, {13,88}, {14,88}, {15,88}, {16,88}, {17,88}, {9,89}, {10,89}, {11,89}, {12,89}, {13,89}, {14,90}, {15,90}, {16,90}, {17,90}, {9,90}, {10,90}, {11,90}, {12,90}, {13,90}, {14,89}, {15,89}, {16,89}, {17,89}, {12,98}, {13,98}, {13,99}, {14,99}, {15,99}, {16,99}, {17,99}, {17,98}, {17,97}, {17,94}, {17,93}, {17,92}, {17,91}, {11,100}, {11,99}, {11,98}, {11,97}, {11,96}, {11,95}, {11,94}, {11,93}, {11,92}, {11,91}, {10,101}, {10,100}, {10,99}, {10,98}, {10,97}, {10,96}, {10,95}, {10,94}, {10,93}, {10,92}, {10,91}, {9,100}, {9,99}, {9,98}, {9,97}, {9,96}, {9,95}, {9,94}, {9,93}, {9,92}, {8,98}, {8,97}, {8,96}, {8,95}, {8,94}, {8,93}, {8,92}, {8,91}, {8,90}, {8,89}, {8,88}, {8,87}, {8,86}, {8,85}, {8,84}, {8,83}, {9,83}, {9,84}, {9,85}, {9,86}, {9,87}, {9,88}, {9,91}, {7,83}, {7,82}, {6,82}, {5,82}, {4,82}, {1,83}, {2,83}, {3,83}, {4,83}, {5,83}, {6,83}, {6,84}, {6,85}, {6,86}, {6,87}, {6,88}, {6,89}, {6,90}, {6,91}, {6,92}, {6,93}, {6,94}, {6,95}, {6,96}, {6,97}, {6,98}, {7,98}, {7,97}, {7,96}, {7,95}, {7,94}, {7,93}, {7,92}, {7,91}, {7,90}, {7,89}, {7,88}, {7,87}, {7,86}, {7,85}, {7,84}, {6,81}, {5,81}, {4,81}, {1,84}, {1,85}, {1,86}, {1,87}, {1,88}, {1,89}, {1,90}, {1,91}, {1,92}, {1,93}, {1,94}, {1,95}, {2,95}, {3,95}, {4,95}, {5,95}, {3,96}, {4,96}, {5,96}, {5,98}, {5,97}, {5,94}, {5,93}, {5,92}, {5,91}, {5,90}, {5,89}, {5,88}, {5,87}, {5,86}, {5,85}, {5,84}, {4,84}, {4,85}, {4,86}, {4,87}, {4,88}, {4,89}, {4,90}, {4,91}, {4,92}, {4,93}, {4,94}, {3,94}, {3,93}, {3,92}, {3,91}, {3,90}, {3,89}, {3,88}, {3,87}, {3,86}, {3,85}, {3,84}, {2,84}, {2,85}, {2,86}, {2,87}, {2,88}, {2,89}, {2,90}, {2,91}, {2,92}, {2,93}, {2,94}, {12,91}, {13,91}, {13,92}, {14,92}, {15,92}, {16,92}, {16,93}, {16,96}, {15,96}, {14,96}, {13,96}, {12,97}, {13,97}, {14,97}, {15,97}, {16,97}, {16,98}, {15,98}, {14,98}, {12,96}, {12,95}, {12,94}, {12,93}, {12,92}, {14,91}, {15,91}, {16,91}, {13,93}, {14,93}, {15,93}, {16,94}, {13,95}, {14,95}, {15,95}, {16,95}, {15,94}, {14,94}, {13,94}, {12,87}, {11,87}, {10,87}, {13,85}, {13,84}, {13,83}, {13,82}, {13,81}, {13,80}, {13,79}, {13,78}, {13,77}, {13,76}, {14,76}, {14,77}, {14,78}, {14,79}, {14,80}, {15,80}, {15,76}, {15,77}, {15,78}, {15,79}, {16,76}, {16,77}, {16,78}, {16,79}, {16,80}, {12,76}, {12,77}, {12,78}, {12,79}, {12,80}};
-    building = BuildingInfo("London Health Sciences Centre - University Campus", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("London Health Sciences Centre - University Campus", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {32,109};
     coordinates = {{29,97}, {30,97}, {31,97}, {32,97}, {29,98}, {30,98}, {31,98}, {32,98}, {29,99}, {29,100}, {29,101}, {29,102}, {29,103}, {29,104}, {29,105}, {29,106}, {29,107}, {29,108}, {29,109}, {29,110}, {29,111}, {29,112}, {28,112}, {28,113}, {32,99}, {32,100}, {32,101}, {32,102}, {32,103}, {32,104}, {32,105}, {32,106}, {32,107}, {32,108}, {32,109}, {31,109}, {30,109}, {31,99}, {31,100}, {31,101}, {31,102}, {31,103}, {31,104}, {31,105}, {31,106}, {31,107}, {31,108}, {30,99}, {30,100}, {30,101}, {30,102}, {30,103}, {30,104}, {30,105}, {30,106}, {30,107}, {30,108}, {33,99}, {33,100}, {33,101}, {33,102}, {34,99}, {34,100}, {34,101}, {34,102}, {35,100}, {35,101}, {35,102}, {28,104}, {27,104}, {26,104}, {25,104}, {24,104}, {24,103}, {25,103}, {26,103}, {27,103}, {28,103}, {24,105}, {24,106}, {25,105}, {25,106}, {25,107}, {25,108}, {26,105}, {26,106}, {26,107}, {26,108}, {27,105}, {27,106}, {27,107}, {27,108}, {24,107}, {24,108}, {23,108}, {23,109}, {22,109}, {22,108}, {24,109}, {24,110}, {23,110}, {22,110}, {22,107}, {21,107}, {21,108}, {31,110}, {30,110}, {28,110}, {27,110}, {26,110}, {26,111}, {26,112}, {26,113}, {26,114}, {25,111}, {25,112}, {25,113}, {27,111}, {28,111}, {30,111}, {30,112}, {30,113}, {29,113}, {28,114}, {27,114}, {27,112}, {27,113}, {27,115}, {29,114}, {28,115}, {31,111}};
-    building = BuildingInfo("Robarts Res. Institute", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("Robarts Res. Institute", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {41,120};
     coordinates = {{45,112}, {45,113}, {45,114}, {45,115}, {45,116}, {44,116}, {44,115}, {44,112}, {44,113}, {44,114}, {43,112}, {43,113}, {43,114}, {43,115}, {43,116}, {42,112}, {42,113}, {42,114}, {42,115}, {42,116}, {42,117}, {41,112}, {41,113}, {41,114}, {41,115}, {41,116}, {41,117}, {43,117}, {39,118}, {40,118}, {41,118}, {42,118}, {40,117}, {40,119}, {40,120}, {41,119}, {39,119}, {38,119}, {37,119}, {36,119}, {35,119}, {34,119}, {33,119}, {35,117}, {35,118}, {35,120}, {35,121}, {34,120}, {36,120}, {37,120}, {38,120}, {39,120}, {32,118}, {33,118}, {34,118}, {36,118}, {37,118}, {33,117}, {34,117}, {36,117}, {34,115}, {34,116}, {35,116}, {33,116}, {32,117}, {36,121}, {37,121}, {38,121}, {38,122}, {37,122}};
-    building = BuildingInfo("Chemistry", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("Chemistry", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {47, 123};
     coordinates = {{48,125}, {49,125}, {50,125}, {48,124}, {49,124}, {50,124}, {51,124}, {47,123}, {48,123}, {49,123}, {50,123}, {51,123}, {47,124}, {47,122}, {47,121}, {47,120}, {47,119}, {47,118}, {46,117}, {46,118}, {46,119}, {46,120}, {47,117}, {48,117}, {49,117}, {49,118}, {49,119}, {49,120}, {49,121}, {49,122}, {50,122}, {50,121}, {50,120}, {50,119}, {50,118}, {50,117}, {48,118}, {48,119}, {48,120}, {48,121}, {48,122}};
-    building = BuildingInfo("Marterial Science Addition", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("Marterial Science Addition", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {49, 130};
     coordinates = {{50,126}, {50,127}, {50,128}, {50,129}, {50,130}, {51,126}, {51,127}, {51,128}, {51,129}, {51,130}, {52,130}, {49,126}, {49,127}, {49,128}, {49,129}, {49,130}, {48,126}, {48,127}, {48,128}};
-    building = BuildingInfo("Biotron", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("Biotron", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {60,113};
     coordinates = {{46,116}, {46,115}, {46,114}, {46,113}, {46,112}, {46,111}, {47,111}, {48,111}, {49,111}, {50,111}, {51,111}, {47,110}, {48,110}, {49,110}, {47,112}, {48,112}, {49,112}, {50,112}, {51,112}, {52,112}, {53,112}, {54,112}, {55,112}, {56,112}, {47,113}, {48,113}, {49,114}, {51,114}, {52,114}, {53,113}, {54,113}, {55,113}, {56,113}, {57,113}, {49,113}, {50,113}, {51,113}, {52,113}, {56,114}, {57,114}, {58,114}, {59,114}, {58,112}, {58,113}, {58,111}, {59,111}, {60,111}, {59,112}, {60,112}, {59,113}, {60,113}, {57,112}, {53,114}, {54,114}, {55,114}, {47,116}, {48,116}, {49,116}, {50,116}, {51,116}, {50,117}, {50,118}, {51,118}, {51,119}, {51,120}, {51,121}, {51,115}, {51,117}, {50,119}, {50,120}, {50,121}, {47,115}, {48,115}, {49,115}, {50,115}, {47,114}, {48,114}, {50,114}, {52,121}, {53,121}, {54,121}, {55,121}, {56,121}, {57,121}, {52,120}, {53,120}, {54,120}, {55,120}, {56,120}, {57,120}, {58,120}, {59,120}, {60,120}, {61,120}, {62,120}, {62,121}, {63,121}, {58,121}, {59,121}, {60,121}, {61,121}, {60,114}, {60,115}, {60,116}, {60,117}, {60,118}, {60,119}, {59,115}, {59,116}, {59,117}, {59,118}, {59,119}, {58,115}, {58,116}, {58,117}, {58,118}, {58,119}, {57,115}, {57,116}, {57,117}, {56,115}, {56,116}, {56,117}, {56,118}, {56,119}, {57,118}, {57,119}, {55,115}, {55,116}, {55,117}, {55,118}, {55,119}, {54,115}, {54,116}, {54,117}, {54,118}, {54,119}, {53,119}, {53,118}, {53,117}, {53,116}, {53,115}, {52,115}, {52,116}, {52,119}, {52,118}, {52,117}, {67,119}, {66,119}, {65,119}, {64,119}, {63,119}, {61,119}, {62,119}, {67,120}, {67,121}, {66,120}, {66,121}, {65,120}, {65,121}, {64,120}, {64,121}, {63,120}, {61,122}, {61,123}, {61,124}, {61,125}, {61,126}, {60,122}, {60,123}, {60,124}, {60,125}, {60,126}, {62,124}, {63,124}, {64,124}, {65,124}, {62,126}, {62,125}, {63,125}, {64,125}, {65,125}, {63,126}, {64,126}, {65,126}, {63,122}, {64,122}, {61,118}, {62,118}, {63,118}, {64,118}, {65,118}, {66,118}, {67,118}};
-    building = BuildingInfo("Biological, Geological Sciences", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("Biological, Geological Sciences", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {74,93};
     coordinates = {{74,95}, {74,94}, {74,93}, {73,94}, {73,93}, {73,92}, {73,91}, {74,92}, {75,95}, {75,94}, {72,92}, {72,91}};
-    building = BuildingInfo("McIntosh Gallery", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("McIntosh Gallery", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {77,101};
     coordinates = {{78,101}, {78,102}, {78,103}, {78,104}, {78,105}, {78,106}, {78,107}, {78,108}, {78,109}, {78,110}, {78,111}, {77,101}, {77,102}, {77,103}, {77,104}, {77,105}, {77,106}, {77,107}, {77,108}, {77,109}, {77,110}, {77,111}, {69,106}, {70,106}, {71,106}, {72,106}, {73,106}, {75,106}, {76,106}, {74,106}, {69,102}, {69,103}, {69,104}, {69,105}, {69,107}, {68,103}, {68,104}, {68,105}, {69,108}, {69,109}, {69,110}, {68,110}, {68,109}, {68,108}, {68,107}, {68,106}, {68,102}, {79,103}, {79,102}, {79,101}, {79,111}, {79,110}, {79,109}, {76,109}, {75,109}, {74,109}, {73,109}, {72,109}, {71,109}, {70,109}, {70,108}, {71,108}, {72,108}, {73,108}, {74,108}, {75,108}, {76,108}, {76,107}, {75,107}, {74,107}, {73,107}, {72,107}, {71,107}, {70,107}, {70,110}, {71,110}, {72,110}, {73,110}, {74,110}, {75,110}, {76,110}, {70,102}, {71,102}, {72,102}, {73,102}, {74,102}, {75,102}, {76,102}, {70,103}, {71,103}, {72,103}, {73,103}, {74,103}, {75,103}, {75,104}, {76,104}, {76,103}, {76,105}, {74,104}, {73,104}, {72,104}, {72,105}, {71,105}, {70,105}, {71,104}, {70,104}, {75,105}, {74,105}, {73,105}};
-    building = BuildingInfo("Physics and Astronomy", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("Physics and Astronomy", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {70,124};
     coordinates = {{69,124}, {69,125}, {69,126}, {69,127}, {70,124}, {70,125}, {70,126}, {70,127}, {71,123}, {71,124}, {71,125}, {71,126}, {71,127}, {72,123}, {72,124}, {72,125}, {72,126}, {73,123}, {73,124}, {73,125}, {73,126}, {74,123}, {74,124}, {74,125}, {74,126}};
-    building = BuildingInfo("Collip", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("Collip", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {75,128};
     coordinates = {{76,130}, {76,129}, {76,128}, {76,127}, {76,126}, {76,125}, {76,124}, {76,123}, {76,122}, {76,121}, {76,120}, {76,119}, {75,128}, {75,127}, {75,126}, {75,125}, {75,124}, {75,123}, {75,122}, {75,121}, {75,120}, {75,119}, {75,118}, {76,118}, {74,118}, {73,118}, {72,118}, {74,119}, {73,119}, {72,119}, {74,120}, {73,120}, {72,120}, {77,118}, {77,119}, {77,120}, {77,121}, {77,122}, {77,123}, {77,124}, {77,125}, {77,126}, {77,127}, {77,128}, {77,129}, {77,130}, {78,118}, {78,119}, {78,120}, {78,121}, {78,122}, {78,123}, {78,124}, {78,125}, {78,126}, {78,127}, {78,128}, {78,129}, {78,130}, {79,118}, {79,119}, {79,120}, {79,121}, {79,122}, {79,123}, {79,124}, {79,125}, {79,126}, {79,127}, {79,128}};
-    building = BuildingInfo("Western Science Centre", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("Western Science Centre", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {92,135};
     coordinates = {{88,136}, {89,136}, {90,136}, {91,136}, {92,136}, {93,136}, {94,136}, {95,136}, {89,137}, {90,137}, {91,137}, {92,137}, {93,137}, {94,137}, {95,137}, {92,135}, {91,138}, {91,139}, {93,135}, {93,138}, {93,139}, {92,138}, {92,139}, {90,138}, {90,139}, {94,138}, {94,139}, {95,135}, {96,135}, {97,135}, {98,135}, {99,135}, {96,136}, {97,136}, {96,137}, {98,136}, {98,134}, {99,134}, {100,134}, {101,134}, {102,134}, {100,133}, {101,133}, {102,133}, {101,132}, {101,135}, {100,135}, {90,135}, {89,135}, {88,135}, {87,135}, {86,135}, {88,134}, {87,134}, {86,134}, {85,134}, {84,134}, {87,133}, {86,133}, {85,133}, {84,133}, {83,133}, {85,132}, {84,132}, {83,132}, {83,134}, {83,131}, {84,131}, {82,132}, {82,133}, {85,135}, {87,136}};
-    building = BuildingInfo("Middlesex College", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("Middlesex College", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {41,137};
     coordinates = {{43,140}, {43,139}, {44,139}, {44,138}, {43,137}, {43,138}, {45,137}, {44,137}, {43,136}, {42,138}, {42,139}, {42,140}, {42,141}, {42,142}, {42,143}, {42,144}, {42,145}, {41,145}, {41,144}, {41,143}, {41,142}, {41,141}, {41,140}, {41,139}, {41,138}, {42,137}, {42,136}, {43,135}, {44,136}, {44,140}, {43,142}, {43,141}, {43,146}, {43,145}, {43,144}, {43,143}, {40,144}, {40,143}, {40,142}, {40,141}, {40,140}, {39,142}, {39,143}, {39,144}, {42,146}, {40,145}, {44,144}, {44,145}, {44,146}, {44,147}, {45,144}, {45,145}, {45,146}, {45,147}, {46,145}, {46,146}, {46,147}, {47,145}, {47,146}, {47,147}, {48,146}};
-    building = BuildingInfo("Western Interdisciplinary Research Building", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("Western Interdisciplinary Research Building", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {70,151};
     coordinates = {{58,153}, {59,153}, {60,153}, {58,152}, {59,152}, {58,154}, {59,154}, {60,154}, {61,154}, {60,152}, {61,155}, {62,155}, {63,155}, {63,156}, {64,156}, {64,157}, {65,157}, {65,158}, {65,148}, {66,148}, {66,149}, {66,150}, {66,151}, {65,151}, {65,152}, {65,153}, {65,154}, {65,155}, {65,156}, {64,155}, {64,154}, {64,153}, {64,152}, {64,151}, {64,150}, {64,149}, {64,148}, {63,151}, {63,152}, {63,149}, {63,150}, {62,151}, {62,152}, {62,150}, {63,154}, {63,157}, {63,158}, {62,157}, {66,158}, {64,158}, {65,159}, {64,159}, {66,146}, {66,147}, {66,152}, {66,153}, {66,155}, {66,156}, {65,146}, {65,147}, {65,149}, {65,150}, {66,145}, {67,148}, {67,149}, {67,150}, {67,151}, {67,152}, {67,153}, {67,154}, {67,155}, {67,156}, {67,157}, {66,157}, {66,154}, {68,155}, {68,154}, {68,153}, {68,152}, {68,151}, {68,150}, {68,149}, {68,148}, {68,147}, {68,146}, {67,147}, {67,146}, {67,145}, {69,153}, {69,152}, {69,151}, {69,150}, {69,149}, {69,148}, {69,147}, {70,151}, {70,150}, {70,149}, {70,148}, {71,149}, {71,148}, {70,147}};
-    building = BuildingInfo("Labatt Visual Arts", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("Labatt Visual Arts", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {81,148};
     coordinates = {{79,149}, {79,150}, {79,151}, {79,152}, {79,153}, {79,154}, {79,155}, {79,156}, {79,157}, {78,148}, {78,149}, {78,150}, {78,151}, {78,152}, {78,153}, {78,154}, {78,155}, {78,156}, {78,157}, {78,158}, {77,149}, {77,150}, {77,151}, {77,152}, {77,153}, {77,154}, {77,155}, {77,156}, {77,157}, {77,158}, {77,159}, {77,160}, {77,161}, {77,162}, {76,152}, {76,153}, {76,154}, {76,155}, {76,156}, {76,157}, {76,158}, {76,159}, {76,160}, {76,161}, {75,154}, {75,155}, {75,156}, {75,157}, {75,158}, {75,159}, {75,160}, {75,161}, {74,156}, {74,157}, {74,158}, {74,159}, {74,160}, {74,161}, {73,158}, {73,159}, {72,158}, {72,159}, {73,157}, {74,155}, {79,148}, {79,158}, {78,159}, {78,160}, {78,161}, {79,159}, {84,152}, {83,152}, {82,152}, {81,152}, {80,152}, {83,151}, {83,153}, {82,150}, {82,151}, {82,153}, {82,154}, {83,150}, {82,149}, {81,149}, {81,150}, {81,151}, {81,153}, {81,154}, {80,148}, {80,149}, {80,150}, {80,151}, {80,153}, {80,154}, {80,155}, {80,156}, {80,157}, {81,155}, {81,156}, {75,153}, {76,151}, {81,148}};
-    building = BuildingInfo("North Campus Building", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("North Campus Building", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {91,151};
     coordinates = {{91,153}, {90,153}, {90,154}, {90,155}, {90,156}, {90,157}, {90,158}, {90,159}, {90,152}, {91,151}, {90,151}, {89,152}, {88,153}, {89,153}, {88,152}, {91,152}, {89,154}, {91,154}, {89,155}, {91,155}, {89,156}, {91,156}, {89,157}, {91,157}, {89,158}, {89,159}, {89,160}, {88,158}, {88,157}, {92,154}, {92,155}, {92,156}, {92,157}, {92,158}, {92,159}, {91,158}, {91,159}, {91,160}, {90,160}, {93,157}, {93,158}, {94,158}, {95,158}, {96,158}, {97,158}, {98,158}, {99,158}, {100,158}, {94,157}, {95,157}, {96,157}, {97,157}, {98,157}, {99,157}, {100,157}, {94,156}, {95,156}, {96,156}, {97,156}, {98,156}, {99,156}, {100,156}, {98,155}, {99,155}, {93,159}, {94,159}, {100,155}, {95,159}, {96,159}, {97,159}};
-    building = BuildingInfo("Staging", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("Staging", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {120,119};
     coordinates = {{125,116}, {124,117}, {123,117}, {123,118}, {122,118}, {122,119}, {121,119}, {121,120}, {122,121}, {123,121}, {125,120}, {126,119}, {127,119}, {125,119}, {124,120}, {123,120}, {126,118}, {124,119}, {123,119}, {125,118}, {125,117}, {124,118}, {126,117}, {122,120}, {126,116}, {127,116}, {127,115}, {128,115}, {129,115}, {129,114}, {130,114}, {131,114}, {131,113}, {132,113}, {132,114}, {130,115}, {128,116}, {127,117}, {128,117}, {129,116}, {130,116}, {131,115}, {132,115}, {131,116}, {129,117}, {128,118}, {127,118}, {128,119}, {129,118}, {129,119}, {130,119}, {130,120}, {131,120}, {132,119}, {133,119}, {134,118}, {135,117}, {136,117}, {135,115}, {134,115}, {134,114}, {133,113}, {133,112}, {132,112}, {133,114}, {133,115}, {133,116}, {133,117}, {134,116}, {132,116}, {131,117}, {132,117}, {130,117}, {130,118}, {135,116}, {132,118}, {133,118}, {131,118}, {131,119}, {134,117}, {132,111}, {132,110}, {131,110}, {131,109}, {130,109}, {130,110}, {129,110}, {129,111}, {128,111}, {127,111}, {127,112}, {126,112}, {126,113}, {125,113}, {124,113}, {125,112}, {128,110}, {133,111}, {131,112}, {130,112}, {130,111}, {131,111}, {129,112}, {128,112}, {128,113}, {129,113}, {130,113}, {127,113}, {127,114}, {128,114}, {126,114}, {125,114}, {126,115}};
-    building = BuildingInfo("Talbot College", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("Talbot College", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {143,103};
     coordinates = {{133,105}, {133,106}, {132,106}, {132,107}, {133,107}, {133,108}, {133,109}, {134,109}, {134,110}, {135,110}, {136,110}, {137,110}, {137,109}, {136,109}, {135,109}, {135,108}, {135,107}, {135,106}, {134,106}, {134,107}, {134,108}, {136,108}, {135,103}, {135,104}, {136,104}, {136,105}, {137,106}, {137,107}, {138,107}, {138,108}, {140,107}, {141,107}, {139,107}, {142,106}, {143,106}, {143,105}, {144,105}, {143,104}, {142,103}, {142,102}, {141,101}, {141,102}, {140,102}, {140,103}, {139,103}, {138,103}, {137,103}, {137,102}, {136,102}, {136,103}, {137,104}, {138,104}, {137,105}, {138,105}, {139,105}, {139,106}, {138,106}, {140,106}, {141,106}, {141,105}, {142,105}, {142,104}, {141,104}, {140,105}, {139,104}, {140,104}, {141,103}, {134,105}, {139,108}, {137,108}};
-    building = BuildingInfo("Music Building", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("Music Building", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {121,93};
     coordinates = {{121,95}, {121,96}, {121,97}, {122,98}, {122,97}, {121,98}, {121,99}, {121,100}, {120,99}, {120,98}, {119,98}, {119,97}, {120,97}, {120,96}, {119,96}, {118,97}, {117,97}, {116,98}, {115,97}, {115,96}, {116,96}, {116,95}, {117,96}, {116,97}, {118,96}, {119,95}, {120,95}, {121,94}, {121,93}, {121,92}, {120,92}, {118,92}, {117,92}, {116,93}, {115,93}, {115,94}, {115,95}, {116,94}, {117,94}, {117,93}, {118,93}, {118,94}, {119,93}, {120,93}, {120,94}, {119,94}, {118,95}, {117,95}, {117,98}, {122,99}, {120,91}, {119,91}, {119,92}, {116,92}, {114,92}, {115,92}, {116,91}, {117,91}, {118,91}, {114,94}};
-    building = BuildingInfo("International & Graduate Affairs Building", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("International & Graduate Affairs Building", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {123,85};
     coordinates = {{112,82}, {113,82}, {114,82}, {114,81}, {115,81}, {116,80}, {117,80}, {118,80}, {119,81}, {119,82}, {120,82}, {120,83}, {120,84}, {121,84}, {121,85}, {122,85}, {122,86}, {123,87}, {123,88}, {123,89}, {122,89}, {122,88}, {121,88}, {121,87}, {121,86}, {122,87}, {120,85}, {119,84}, {119,83}, {118,82}, {118,83}, {118,81}, {117,81}, {116,81}, {116,82}, {115,82}, {115,83}, {114,83}, {113,83}, {112,83}, {111,84}, {112,84}, {112,85}, {112,86}, {113,87}, {113,88}, {113,89}, {114,89}, {115,88}, {116,88}, {117,87}, {118,87}, {118,86}, {119,86}, {120,86}, {119,85}, {118,85}, {117,85}, {116,85}, {117,83}, {117,82}, {116,83}, {115,84}, {116,84}, {117,84}, {114,84}, {114,85}, {113,84}, {113,85}, {113,86}, {114,88}, {115,87}, {116,87}, {116,86}, {115,86}, {115,85}, {114,86}, {114,87}, {117,86}, {118,84}, {119,87}, {119,88}, {120,88}, {120,87}, {118,88}, {117,88}, {117,89}, {116,89}, {115,89}, {114,90}, {113,90}, {113,91}, {121,90}, {122,90}, {120,90}, {119,90}, {118,90}, {118,89}, {119,89}, {120,89}, {121,89}, {115,90}, {116,90}, {117,90}, {114,91}, {115,91}, {112,81}, {111,83}, {112,90}};
-    building = BuildingInfo("Arts & Humanities Building", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("Arts & Humanities Building", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {136,76};
     coordinates = {{137,77}, {138,78}, {139,79}, {139,80}, {139,81}, {140,81}, {140,82}, {140,83}, {141,83}, {141,84}, {142,84}, {142,85}, {142,86}, {143,86}, {143,87}, {144,88}, {145,87}, {145,86}, {144,85}, {144,84}, {143,84}, {143,83}, {143,82}, {144,83}, {144,81}, {144,80}, {143,85}, {144,86}, {144,87}, {141,85}, {139,82}, {138,81}, {138,80}, {137,79}, {136,78}, {135,77}, {136,77}, {136,76}, {138,77}, {138,79}, {137,78}, {138,76}, {139,76}, {140,76}, {140,75}, {141,75}, {141,76}, {141,77}, {140,77}, {140,78}, {139,78}, {141,78}, {139,77}, {142,77}, {142,78}, {140,79}, {140,80}, {141,80}, {143,79}, {143,78}, {142,79}, {141,79}, {144,78}, {142,80}, {142,81}, {143,80}, {141,81}, {141,82}, {142,82}, {143,81}, {142,83}, {146,79}, {147,79}, {148,80}, {149,80}, {149,81}, {149,82}, {150,82}, {150,83}, {150,84}, {151,83}, {152,82}, {151,81}, {150,80}, {150,79}, {149,78}, {149,79}, {151,82}, {150,81}, {148,78}, {148,77}, {147,76}, {146,75}, {145,76}, {144,76}, {144,77}, {143,77}, {145,77}, {146,77}, {146,76}, {147,77}, {145,78}, {144,79}, {145,79}, {148,79}, {147,78}, {146,78}, {145,75}, {144,75}, {144,74}, {143,75}, {142,75}, {142,76}, {143,76}, {143,74}, {142,74}, {143,73}, {137,80}, {146,87}, {144,82}, {149,83}, {151,80}, {152,81}, {145,74}, {147,75}};
-    building = BuildingInfo("FIMS & Nursing", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("FIMS & Nursing", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {154,75};
     coordinates = {{152,70}, {151,71}, {151,72}, {152,73}, {154,76}, {154,75}, {155,75}, {156,75}, {156,76}, {159,76}, {158,75}, {157,75}, {157,76}, {159,75}, {159,74}, {158,74}, {157,74}, {158,76}, {160,75}, {160,74}, {160,73}, {159,73}, {159,72}, {158,72}, {158,73}, {158,71}, {157,71}, {157,72}, {156,69}, {156,70}, {156,68}, {155,67}, {155,68}, {154,66}, {154,67}, {153,66}, {152,66}, {153,67}, {152,67}, {151,67}, {152,68}, {153,68}, {152,69}, {153,69}, {154,69}, {154,68}, {153,70}, {152,71}, {153,71}, {154,70}, {155,69}, {155,70}, {154,71}, {152,72}, {153,72}, {154,72}, {155,71}, {156,71}, {155,72}, {153,73}, {156,72}, {155,73}, {156,73}, {157,73}, {154,73}, {154,74}, {155,74}, {156,74}, {153,74}, {153,75}, {158,77}, {157,77}, {160,76}, {159,77}, {159,71}, {154,65}, {150,71}, {151,70}, {153,76}, {152,74}, {157,69}, {157,70}};
-    building = BuildingInfo("Labatt Health Science Building", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("Labatt Health Science Building", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {138,58};
     coordinates = {{138,46}, {138,47}, {138,48}, {138,49}, {137,48}, {137,47}, {136,48}, {136,49}, {135,49}, {134,50}, {133,51}, {133,52}, {133,53}, {132,53}, {132,54}, {133,54}, {134,54}, {134,55}, {135,55}, {136,55}, {136,56}, {137,56}, {137,57}, {138,57}, {139,56}, {140,56}, {141,55}, {141,54}, {141,53}, {142,52}, {141,51}, {140,51}, {140,50}, {139,49}, {139,50}, {139,51}, {140,52}, {137,49}, {137,50}, {138,50}, {136,50}, {135,50}, {136,51}, {137,51}, {134,51}, {134,52}, {135,52}, {136,52}, {137,52}, {135,51}, {134,53}, {135,53}, {136,53}, {135,54}, {136,54}, {137,53}, {138,53}, {138,52}, {138,51}, {137,55}, {137,54}, {138,54}, {138,55}, {139,55}, {139,54}, {139,53}, {138,56}, {140,55}, {140,54}, {140,53}, {141,52}, {139,52}, {139,57}, {133,55}, {131,54}, {139,48}, {142,53}};
-    building = BuildingInfo("Alumini Hall", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("Alumini Hall", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {136,41};
     coordinates = {{137,41}, {138,41}, {138,40}, {139,41}, {139,40}, {137,40}};
-    building = BuildingInfo("Cronyn Observatory", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("Cronyn Observatory", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {136,35};
     coordinates = {{149,18}, {149,19}, {149,20}, {150,20}, {150,21}, {150,19}, {150,22}, {150,23}, {151,23}, {149,23}, {148,24}, {149,24}, {150,24}, {147,24}, {148,23}, {149,21}, {148,21}, {147,21}, {147,22}, {147,23}, {149,22}, {148,20}, {148,22}, {148,19}, {148,18}, {147,19}, {146,19}, {145,19}, {145,20}, {145,21}, {145,22}, {145,23}, {146,23}, {146,24}, {146,22}, {147,20}, {146,21}, {146,20}, {147,25}, {148,25}, {148,26}, {149,25}, {149,26}, {149,27}, {149,28}, {150,28}, {150,29}, {150,30}, {149,30}, {148,30}, {147,30}, {145,31}, {144,31}, {144,30}, {144,29}, {144,28}, {143,28}, {143,29}, {143,30}, {145,30}, {146,30}, {147,29}, {146,29}, {145,29}, {148,29}, {149,29}, {148,28}, {147,28}, {146,28}, {145,28}, {147,27}, {148,27}, {147,26}, {146,26}, {145,26}, {145,27}, {146,25}, {145,25}, {144,25}, {144,26}, {144,27}, {146,27}, {145,24}, {144,24}, {144,23}, {143,23}, {142,23}, {142,22}, {143,22}, {141,23}, {140,23}, {141,22}, {140,24}, {141,24}, {141,25}, {141,26}, {142,26}, {142,25}, {142,24}, {140,25}, {143,25}, {143,24}, {143,26}, {140,26}, {140,27}, {141,27}, {142,27}, {143,27}, {139,27}, {142,28}, {141,28}, {140,28}, {140,29}, {139,29}, {142,29}, {141,29}, {140,30}, {139,30}, {138,30}, {137,30}, {137,29}, {137,28}, {138,28}, {138,27}, {139,28}, {138,29}, {130,25}, {130,26}, {131,26}, {132,26}, {132,25}, {133,25}, {134,25}, {135,25}, {136,25}, {137,25}, {137,24}, {137,23}, {137,22}, {136,22}, {136,23}, {135,23}, {134,23}, {133,23}, {132,23}, {131,23}, {131,24}, {130,24}, {131,25}, {134,24}, {135,24}, {136,24}, {133,24}, {132,24}, {133,26}, {133,27}, {132,27}, {133,28}, {133,29}, {134,29}, {134,30}, {134,31}, {135,30}, {135,29}, {136,29}, {136,28}, {135,28}, {134,28}, {134,27}, {134,26}, {135,27}, {135,26}, {135,31}, {136,31}, {136,32}, {136,30}, {136,33}, {136,34}, {137,34}, {137,35}, {137,36}, {136,36}, {135,36}, {135,35}, {136,35}, {135,37}, {135,38}, {136,38}, {136,39}, {137,39}, {138,39}, {138,38}, {138,37}, {138,36}, {137,37}, {136,37}, {137,38}, {137,33}, {137,32}, {135,32}, {134,32}, {134,33}, {134,34}, {135,34}, {135,33}, {146,31}, {151,22}};
-    building = BuildingInfo("Spencer Engineering Building", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("Spencer Engineering Building", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {157,29};
     coordinates = {{157,30}, {158,30}, {158,29}, {157,29}, {160,28}, {161,28}, {164,27}, {164,28}, {165,28}, {166,28}, {167,27}, {168,27}, {169,27}, {170,27}, {171,28}, {170,28}, {170,29}, {171,29}, {168,30}, {167,30}, {166,30}, {169,29}, {168,29}, {167,29}, {166,29}, {168,28}, {167,28}, {169,28}, {165,29}, {164,29}, {163,29}, {162,29}, {162,28}, {163,28}, {162,30}, {163,30}, {164,30}, {165,30}, {163,31}, {162,31}, {161,31}, {164,31}, {165,31}, {166,31}, {163,32}, {162,32}, {161,32}, {160,32}, {159,32}, {158,32}, {157,33}, {156,33}, {157,32}, {156,32}, {155,32}, {155,31}, {156,31}, {157,31}, {158,31}, {159,31}, {160,31}, {161,30}, {160,30}, {159,30}, {161,29}, {160,29}, {159,29}, {158,33}, {163,27}, {166,27}, {170,26}, {169,30}, {171,27}};
-    building = BuildingInfo("Thompson Engineering", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("Thompson Engineering", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {165,12};
     coordinates = {{150,17}, {150,18}, {150,19}, {151,19}, {151,20}, {152,20}, {153,20}, {154,20}, {154,19}, {155,19}, {156,19}, {157,19}, {158,19}, {159,18}, {160,18}, {161,18}, {162,17}, {163,17}, {164,17}, {165,17}, {166,16}, {166,15}, {165,13}, {164,13}, {163,14}, {162,14}, {161,14}, {160,14}, {158,15}, {157,15}, {156,16}, {155,16}, {154,16}, {153,16}, {151,17}, {151,18}, {152,19}, {152,18}, {152,17}, {153,18}, {154,17}, {153,17}, {153,19}, {154,18}, {155,17}, {156,17}, {157,17}, {158,17}, {155,18}, {156,18}, {157,18}, {158,18}, {159,17}, {160,17}, {161,17}, {161,16}, {162,16}, {163,16}, {164,16}, {165,16}, {165,14}, {164,14}, {163,15}, {164,15}, {165,15}, {162,15}, {161,15}, {160,15}, {159,15}, {158,16}, {159,16}, {157,16}, {160,16}, {151,21}};
-    building = BuildingInfo("Amit Chakma Engineering Building", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("Amit Chakma Engineering Building", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {146,36};
     coordinates = {{145,32}, {146,32}, {147,32}, {148,32}, {148,31}, {149,31}, {150,31}, {150,32}, {151,32}, {151,33}, {151,34}, {152,34}, {152,35}, {152,36}, {151,36}, {150,36}, {149,36}, {148,36}, {147,36}, {146,36}, {146,35}, {146,34}, {145,34}, {145,33}, {146,33}, {147,33}, {149,32}, {149,33}, {150,33}, {150,34}, {149,34}, {150,35}, {151,35}, {149,35}, {148,35}, {147,35}, {147,34}, {148,33}, {148,34}};
-    building = BuildingInfo("MacKay Lassonde Pavillion", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("MacKay Lassonde Pavillion", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {179,24};
     coordinates = {{178,14}, {179,14}, {180,14}, {180,13}, {181,13}, {182,13}, {183,13}, {186,12}, {189,12}, {189,13}, {190,13}, {191,13}, {191,14}, {192,16}, {192,17}, {192,19}, {191,20}, {190,20}, {189,20}, {188,20}, {188,21}, {187,21}, {189,21}, {186,20}, {185,21}, {187,20}, {190,19}, {190,18}, {191,18}, {189,18}, {188,19}, {187,19}, {186,19}, {185,20}, {189,19}, {191,17}, {190,17}, {189,17}, {187,17}, {185,17}, {184,18}, {183,19}, {191,19}, {192,18}, {188,18}, {187,18}, {186,18}, {188,17}, {184,17}, {182,18}, {185,18}, {190,16}, {189,16}, {189,15}, {188,15}, {187,15}, {186,15}, {185,16}, {183,17}, {186,17}, {191,16}, {191,15}, {190,15}, {189,14}, {187,14}, {185,15}, {184,16}, {183,16}, {182,17}, {183,18}, {184,15}, {186,16}, {187,16}, {188,16}, {188,14}, {186,14}, {190,14}, {188,13}, {187,13}, {186,13}, {185,13}, {184,13}, {184,14}, {183,14}, {182,14}, {181,14}, {181,15}, {182,15}, {182,16}, {180,15}, {180,16}, {181,16}, {185,14}, {179,15}, {178,16}, {179,16}, {178,15}, {177,16}, {177,17}, {177,18}, {177,19}, {177,20}, {178,21}, {178,22}, {179,22}, {179,23}, {180,23}, {180,22}, {179,21}, {180,20}, {180,19}, {179,18}, {179,17}, {178,17}, {178,18}, {178,19}, {179,20}, {180,21}, {179,19}, {178,20}, {181,20}, {181,19}, {182,19}, {185,19}, {184,19}, {181,17}, {180,17}, {180,18}, {181,18}, {183,15}, {182,20}, {182,21}, {182,22}, {181,22}, {181,23}, {180,24}, {181,24}, {181,25}, {181,26}, {182,26}, {182,27}, {182,28}, {182,29}, {183,29}, {183,28}, {184,28}, {185,28}, {186,28}, {187,28}, {189,27}, {190,27}, {190,26}, {191,26}, {192,26}, {192,25}, {192,24}, {191,24}, {191,23}, {191,22}, {191,21}, {190,21}, {190,22}, {190,23}, {189,22}, {188,22}, {184,20}, {183,20}, {186,21}, {181,21}, {183,22}, {184,22}, {185,22}, {186,22}, {187,22}, {184,21}, {183,21}, {187,23}, {188,23}, {186,23}, {185,23}, {185,24}, {186,24}, {187,24}, {189,24}, {190,24}, {189,23}, {188,24}, {189,25}, {187,25}, {188,25}, {190,25}, {187,26}, {188,26}, {189,26}, {191,25}, {186,26}, {186,27}, {187,27}, {188,27}, {185,27}, {185,26}, {184,26}, {183,26}, {183,27}, {184,27}, {186,25}, {185,25}, {184,25}, {183,25}, {184,24}, {183,24}, {182,23}, {182,24}, {182,25}, {184,23}, {183,23}, {181,27}, {181,28}, {192,22}, {192,23}, {192,15}, {190,12}, {185,12}, {187,12}, {188,12}};
-    building = BuildingInfo("Thompson Recreational & Athletic Centre", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("Thompson Recreational & Athletic Centre", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {179,26};
     coordinates = {{179,25}, {180,25}, {180,26}, {180,27}, {181,29}, {181,30}, {181,31}, {182,32}, {182,31}, {183,31}, {183,30}, {182,30}, {184,30}, {184,29}, {185,29}, {186,29}, {187,29}, {187,28}, {188,28}, {189,28}, {190,28}, {191,28}, {192,28}, {192,27}, {193,28}, {193,29}, {193,30}, {193,31}, {194,31}, {194,30}, {192,32}, {189,33}, {188,33}, {188,34}, {189,34}, {191,32}, {190,32}, {189,32}, {192,31}, {191,31}, {188,32}, {192,30}, {191,30}, {189,31}, {188,31}, {187,32}, {190,31}, {190,30}, {189,30}, {188,30}, {187,30}, {187,31}, {192,29}, {191,29}, {190,29}, {189,29}, {188,29}, {186,30}, {185,30}, {185,31}, {184,31}, {186,31}, {185,32}, {184,32}, {184,33}, {183,33}, {185,33}, {186,33}, {186,32}, {187,33}, {187,34}, {187,35}, {188,35}, {189,35}, {190,37}, {189,37}, {189,38}, {190,38}, {190,39}, {190,40}, {190,41}, {191,41}, {191,42}, {191,43}, {192,44}, {191,45}, {191,46}, {190,46}, {189,46}, {189,47}, {188,47}, {187,47}, {182,33}, {182,34}, {182,35}, {183,35}, {183,36}, {183,37}, {183,38}, {184,38}, {184,39}, {184,40}, {185,41}, {185,42}, {185,43}, {186,43}, {186,44}, {186,45}, {187,45}, {187,46}, {188,46}, {189,45}, {190,45}, {190,44}, {189,44}, {188,45}, {191,44}, {190,43}, {189,43}, {188,43}, {187,43}, {187,44}, {188,44}, {189,42}, {188,42}, {187,42}, {190,42}, {189,41}, {188,41}, {187,41}, {186,41}, {186,42}, {189,40}, {188,39}, {187,39}, {186,39}, {186,40}, {185,40}, {188,40}, {189,39}, {185,39}, {187,40}, {188,38}, {187,38}, {186,38}, {185,38}, {188,37}, {187,36}, {186,36}, {185,36}, {185,37}, {187,37}, {188,36}, {189,36}, {186,35}, {185,35}, {184,36}, {184,37}, {186,37}, {186,34}, {183,34}, {184,34}, {184,35}, {183,32}, {185,34}, {179,26}, {179,24}, {180,28}, {181,28}, {190,35}, {190,36}, {193,27}};
-    building = BuildingInfo("Western Student Recreation Centre", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("Western Student Recreation Centre", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 
     entrance = {158,24};
     coordinates = {{160,20}, {161,20}, {162,20}, {162,19}, {163,19}, {164,19}, {165,19}, {166,19}, {167,19}, {168,19}, {168,18}, {169,18}, {167,18}, {166,18}, {165,18}, {169,19}, {170,19}, {170,20}, {169,20}, {168,20}, {168,21}, {169,21}, {169,22}, {170,22}, {170,23}, {170,24}, {169,24}, {168,24}, {167,24}, {167,25}, {166,25}, {165,25}, {164,26}, {163,26}, {160,21}, {161,21}, {161,22}, {161,23}, {161,24}, {161,25}, {161,26}, {162,26}, {162,25}, {163,25}, {164,25}, {164,24}, {165,24}, {163,24}, {162,24}, {166,24}, {168,23}, {167,23}, {166,23}, {169,23}, {168,22}, {167,22}, {166,22}, {165,23}, {165,22}, {167,21}, {166,20}, {164,20}, {163,20}, {163,21}, {164,21}, {166,21}, {165,20}, {165,21}, {167,20}, {162,21}, {162,22}, {162,23}, {163,23}, {164,23}, {164,22}, {163,22}, {160,23}, {160,24}, {160,25}, {159,26}, {160,26}, {159,27}, {160,27}, {159,25}, {159,24}, {160,22}};
-    building = BuildingInfo("Wind Tunnel", coordinates, entrance);
-    buildings.push_back(building);
+    building = BuildingInfo("Wind Tunnel", std::move(coordinates), entrance);
+    buildings.push_back(std::move(building));
 }
 
 /**
- * method for get coordinates of building in map
+ * Builds the name lookup table once the buildings are loaded.
+ * The table is kept at most half full so a lookup is one or two probes.
+*/
+void BuildingDictionary::initializeNameIndex() {
+    buildings.shrink_to_fit();
+    unsigned int size = 1;
+    while(size < buildings.size() * 2) {
+        size <<= 1;
+    }
+    nameSlots.assign(size, -1);
+    for(int id = 0; id < (int) buildings.size(); id++) {
+        unsigned int slot = hashName(buildings[id].getName()) & (size - 1);
+        while(nameSlots[slot] != -1) {
+            slot = (slot + 1) & (size - 1);
+        }
+        nameSlots[slot] = id;
+    }
+}
+
+/**
+ * Builds the cell to building grid once the buildings are loaded.
+ * When footprints overlap, the building listed first keeps the cell.
+*/
+void BuildingDictionary::initializeCellIndex() {
+    cellOwners.assign(MAP_ROWS * MAP_COLUMNS, 0);
+    for(int id = (int) buildings.size() - 1; id >= 0; id--) {
+        for(const FootprintSpan& span: buildings[id].getFootprint()) {
+            for(int col = span.colBegin; col <= span.colEnd; col++) {
+                cellOwners[span.row * MAP_COLUMNS + col] = id + 1;
+            }
+        }
+    }
+}
+
+/**
+ * FNV-1a hash of a building name.
+ * @param buildingName: name of building.
+ * @return hash: the hash of the name.
+*/
+unsigned int BuildingDictionary::hashName(const std::string& buildingName) {
+    unsigned int hash = 2166136261u;
+    for(unsigned char c: buildingName) {
+        hash = (hash ^ c) * 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * Returns the shared dictionary, building it on first use.
+ * @return instance: the process-wide building dictionary.
+*/
+const BuildingDictionary& BuildingDictionary::getInstance() {
+    static const BuildingDictionary instance;
+    return instance;
+}
+
+/**
+ * method for find the id of a building by name
  * @param buildingName: name of building.
- * @return result: the coordinates of selected building.
+ * @return id: the index of the building in getBuildings(), or -1 if there is no such building.
  * 
 */
-std::vector<std::pair<int,int>> BuildingDictionary::getCoordinates(std::string buildingName) {
-    for(BuildingInfo building :buildings) {
-        if(building.getName() == buildingName) {
-            return building.getCoordinates();
+int BuildingDictionary::findBuilding(const std::string& buildingName) const {
+    if(nameSlots.empty()) {
+        return -1;
+    }
+    unsigned int mask = nameSlots.size() - 1;
+    unsigned int slot = hashName(buildingName) & mask;
+    while(nameSlots[slot] != -1) {
+        int id = nameSlots[slot];
+        if(buildings[id].getName() == buildingName) {
+            return id;
         }
+        slot = (slot + 1) & mask;
+    }
+    return -1;
+}
+
+/**
+ * method for get building by id
+ * @param id: the index of the building.
+ * @return building: the building info.
+ * 
+*/
+const BuildingInfo& BuildingDictionary::getBuilding(int id) const {
+    return buildings[id];
+}
+
+/**
+ * method for find the building covering a cell
+ * @param row: the row of the cell.
+ * @param col: the column of the cell.
+ * @return id: the index of the building covering the cell, or -1 if there is none.
+ * 
+*/
+int BuildingDictionary::getBuildingAt(int row, int col) const {
+    if(row < 0 || row >= MAP_ROWS || col < 0 || col >= MAP_COLUMNS) {
+        return -1;
+    }
+    return cellOwners[row * MAP_COLUMNS + col] - 1;
+}
+
+/**
+ * method for get coordinates of building in map
+ * @param buildingName: name of building.
+ * @return result: the footprint of selected building, empty if there is no such building.
+ * 
+*/
+const std::vector<FootprintSpan>& BuildingDictionary::getCoordinates(const std::string& buildingName) const {
+    static const std::vector<FootprintSpan> empty;
+    int id = findBuilding(buildingName);
+    if(id == -1) {
+        return empty;
     }
-    std::vector<std::pair<int,int>> result;
-    return result;
+    return buildings[id].getFootprint();
 }
 
 /**
@@ -285,6 +390,63 @@ std::vector<std::pair<int,int>> BuildingDictionary::getCoordinates(std::string b
  * @return buildings: the list of building infos.
  * 
 */
-std::vector<BuildingInfo> BuildingDictionary::getBuildings() {
+const std::vector<BuildingInfo>& BuildingDictionary::getBuildings() const {
     return buildings;
-}
\ No newline at end of file
+}
+
+/**
+ * method for get number of buildings
+ * @return count: the number of buildings in the dictionary.
+ * 
+*/
+int BuildingDictionary::getBuildingCount() const {
+    return buildings.size();
+}
+
+/**
+ * method for get the memory of the dictionary, shared by every session
+ * @return bytes: the memory of the buildings, their names and footprints, and the indexes.
+ * 
+*/
+long BuildingDictionary::getMemoryBytes() const {
+    long bytes = sizeof(BuildingDictionary) + buildings.capacity() * sizeof(BuildingInfo) + nameSlots.capacity() * sizeof(int) + cellOwners.capacity();
+    for(const BuildingInfo& building: buildings) {
+        bytes += building.getName().capacity() + building.getFootprint().capacity() * sizeof(FootprintSpan);
+    }
+    return bytes;
+}
+
+/**
+ * method for get the cells of a building a route may start or end on
+ * @param id: the index of the building.
+ * @param scope: ENTRANCE for the recorded entrance only, ENTRANCES for every open cell of the footprint,
+ * which are its doors, and the entrance, FOOTPRINT for every open cell on or next to the footprint.
+ * @param map: the map the route is searched on, its walls are left out.
+ * @param cells: the cells are added at its end, sorted and each once.
+ * 
+*/
+void BuildingDictionary::appendBuildingCells(int id, int scope, const LevelMap& map, std::vector<std::pair<int, int>>& cells) const {
+    const BuildingInfo& building = buildings[id];
+    size_t begin = cells.size();
+    auto addOpen = [&](int row, int col) {
+        if(row >= 0 && row < map.getRows() && col >= 0 && col < map.getColumns() && map.getNode(row, col)->getType() != 5) {
+            cells.push_back(std::make_pair(row, col));
+        }
+    };
+    addOpen(building.getEntrance().first, building.getEntrance().second);
+    if(scope != ENTRANCE) {
+        for(const FootprintSpan& span: building.getFootprint()) {
+            for(int col = span.colBegin; col <= span.colEnd; col++) {
+                addOpen(span.row, col);
+                if(scope == FOOTPRINT) {
+                    addOpen(span.row - 1, col);
+                    addOpen(span.row + 1, col);
+                    addOpen(span.row, col - 1);
+                    addOpen(span.row, col + 1);
+                }
+            }
+        }
+    }
+    std::sort(cells.begin() + begin, cells.end());
+    cells.erase(std::unique(cells.begin() + begin, cells.end()), cells.end());
+}
@@ -6,17 +6,54 @@ and the methods that are used to initialize the map of buildings and their locat
 */
 #ifndef BUILDINGDICTIONARY_H
 #define BUILDINGDICTIONARY_H
+#include <utility>
+#include <vector>
 #include "BuildingInfo.h"
+
+class LevelMap;
+
+/**
+ * Process-wide, read-only dictionary of the campus buildings.
+ * It is built once on first use and shared by every session, so all accessors are const
+ * and hand out references into the dictionary instead of copies.
+*/
 class BuildingDictionary {
     public:
+        // size of the campus grid the footprints are drawn on
+        static const int MAP_ROWS = 200;
+        static const int MAP_COLUMNS = 168;
+        // the cells of a building a route may start or end on, see appendBuildingCells
+        static const int ENTRANCE = 0;
+        static const int ENTRANCES = 1;
+        static const int FOOTPRINT = 2;
+
+        static const BuildingDictionary& getInstance();
+        BuildingDictionary(const BuildingDictionary&) = delete;
+        BuildingDictionary& operator=(const BuildingDictionary&) = delete;
+
+        int findBuilding(const std::string& buildingName) const;
+        const BuildingInfo& getBuilding(int id) const;
+        int getBuildingAt(int row, int col) const;
+        const std::vector<FootprintSpan>& getCoordinates(const std::string& buildingName) const;
+        const std::vector<BuildingInfo>& getBuildings() const;
+        int getBuildingCount() const;
+        void appendBuildingCells(int id, int scope, const LevelMap& map, std::vector<std::pair<int, int>>& cells) const;
+        long getMemoryBytes() const;
+    private:
         BuildingDictionary() {
             initializeMapBuildingLocations();
+            initializeNameIndex();
+            initializeCellIndex();
         }
-        std::vector<std::pair<int,int>> getCoordinates(std::string buildingName);
-        std::vector<BuildingInfo> getBuildings();
-    private:
         std::vector<BuildingInfo> buildings;
+        // open addressing table of building ids keyed by name hash, -1 marks an empty slot
+        std::vector<int> nameSlots;
+        // one byte per campus cell: the id of the building covering it plus one, 0 for no building
+        std::vector<unsigned char> cellOwners;
         void initializeMapBuildingLocations();
+        void initializeNameIndex();
+        void initializeCellIndex();
+        static unsigned int hashName(const std::string& buildingName);
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -1,21 +1,45 @@
 #include "BuildingInfo.h"
+#include <algorithm>
+
+/**
+ * Constructor that compresses the list of footprint cells into per-row spans.
+ * @param name: the name of building.
+ * @param coordinates: every cell covered by the building, in any order, duplicates allowed. Sorted in place, so pass it with std::move when it is not needed afterwards.
+ * @param entrance: the entrance location of building.
+*/
+BuildingInfo::BuildingInfo(std::string name, std::vector<std::pair<int, int>> coordinates, std::pair<int, int> entrance) {
+    this->name = std::move(name);
+    this->entrance = entrance;
+    std::sort(coordinates.begin(), coordinates.end());
+    for(std::pair<int, int> cell: coordinates) {
+        if(!footprint.empty()) {
+            FootprintSpan& last = footprint.back();
+            if(last.row == cell.first && last.colEnd + 1 >= cell.second) {
+                last.colEnd = std::max<short>(last.colEnd, cell.second);
+                continue;
+            }
+        }
+        footprint.push_back({(short) cell.first, (short) cell.second, (short) cell.second});
+    }
+    footprint.shrink_to_fit();
+}
 
 /**
  * Get the name of building
  * @return name: the name of building.
  * 
 */
-std::string BuildingInfo::getName() {
+const std::string& BuildingInfo::getName() const {
     return name;
 }
 
 /**
- * Get the coordinates of building
- * @return coordinates: the coordinates of building.
+ * Get the footprint of building as row spans
+ * @return footprint: the cells covered by the building, one span per row run.
  * 
 */
-std::vector<std::pair<int, int>> BuildingInfo::getCoordinates() {
-    return coordinates;
+const std::vector<FootprintSpan>& BuildingInfo::getFootprint() const {
+    return footprint;
 }
 
 /**
@@ -23,6 +47,38 @@ std::vector<std::pair<int, int>> BuildingInfo::getCoordinates() {
  * @return entrance: the entance location of building.
  * 
 */
-std::pair<int, int> BuildingInfo::getEntrance() {
+std::pair<int, int> BuildingInfo::getEntrance() const {
     return entrance;
-}
\ No newline at end of file
+}
+
+/**
+ * Check whether a cell is covered by the building
+ * @param row: the row of the cell.
+ * @param col: the column of the cell.
+ * @return true if the cell is part of the footprint, otherwise false.
+ * 
+*/
+bool BuildingInfo::contains(int row, int col) const {
+    auto it = std::lower_bound(footprint.begin(), footprint.end(), row, [](const FootprintSpan& span, int r) {
+        return span.row < r;
+    });
+    for(; it != footprint.end() && it->row == row; ++it) {
+        if(col >= it->colBegin && col <= it->colEnd) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Get the number of cells covered by the building
+ * @return count: the number of footprint cells.
+ * 
+*/
+int BuildingInfo::getCellCount() const {
+    int count = 0;
+    for(const FootprintSpan& span: footprint) {
+        count += span.colEnd - span.colBegin + 1;
+    }
+    return count;
+}
@@ -9,23 +9,32 @@
 #include <string>
 #include <vector>
 
+/**
+ * A run of consecutive cells on a single row of the map, from colBegin to colEnd inclusive.
+ * Building footprints are stored as a list of these instead of one entry per cell.
+*/
+struct FootprintSpan {
+    short row;
+    short colBegin;
+    short colEnd;
+};
+
 class BuildingInfo {
     public:
         BuildingInfo(){};
-        BuildingInfo(std::string name, std::vector<std::pair<int, int>> coordinates, std::pair<int, int> entrance){
-            this->name = name;
-            this->coordinates = coordinates;
-            this->entrance = entrance;
-        }
+        BuildingInfo(std::string name, std::vector<std::pair<int, int>> coordinates, std::pair<int, int> entrance);
 
-        std::string getName();
-        std::vector<std::pair<int, int>> getCoordinates();
-        std::pair<int, int> getEntrance();
+        const std::string& getName() const;
+        const std::vector<FootprintSpan>& getFootprint() const;
+        std::pair<int, int> getEntrance() const;
+        bool contains(int row, int col) const;
+        int getCellCount() const;
 
     private:
         std::string name;
         std::pair<int, int> entrance;
-        std::vector<std::pair<int, int>> coordinates;
+        // sorted by row then column, spans never overlap
+        std::vector<FootprintSpan> footprint;
 };
 
-#endif
\ No newline at end of file
+#endif
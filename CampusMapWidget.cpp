@@ -0,0 +1,143 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: To draw the campus map as one painted widget instead of a table of cells.
+*/
+
+#include "CampusMapWidget.h"
+#include <Wt/WBrush.h>
+#include <Wt/WColor.h>
+#include <Wt/WPainterPath.h>
+#include "TraceEncoder.h"
+
+/**
+* Class constructor for the campus board.
+* A click anywhere on the board is turned into the clicked cell's row and column.
+* @param dictionary: the shared building dictionary used to draw the highlighted buildings.
+*/
+CampusMapWidget::CampusMapWidget(const BuildingDictionary* dictionary)
+{
+    dictionary_ = dictionary;
+    startBuildingId_ = -1;
+    targetBuildingId_ = -1;
+    setPreferredMethod(RenderMethod::HtmlCanvas);
+    resize(COLUMNS * CELL_SIZE, ROWS * CELL_SIZE);
+    setStyleClass("campus-board");
+    // client side animation of a trace: visited cells first, then the path, one cell every 5ms
+    setJavaScriptMember("naviStop", "function() {"
+        "if (this.naviFrame) cancelAnimationFrame(this.naviFrame);"
+        "this.naviFrame = null;"
+        "}");
+    setJavaScriptMember("naviAnimate", "function(visited, path) {"
+        "var el = this, canvas = el.getElementsByTagName('canvas')[0];"
+        "if (!canvas) return;"
+        "el.naviStop();"
+        "var ctx = canvas.getContext('2d'), cells = [], c = 0, i;"
+        "for (i = 0; i < visited.length; i++) { c += visited[i]; cells.push(c); }"
+        "var visitedCount = cells.length;"
+        "for (i = 0, c = 0; i < path.length; i++) { c += path[i]; cells.push(c); }"
+        "var start = Date.now(), drawn = 0;"
+        "function frame() {"
+          "var due = Math.min(cells.length, Math.floor((Date.now() - start) / 5) + 1);"
+          "for (; drawn < due; drawn++) {"
+            "ctx.fillStyle = drawn < visitedCount ? 'rgba(0,190,218,0.75)' : 'rgb(255,254,106)';"
+            "ctx.fillRect((cells[drawn] % " + std::to_string(COLUMNS) + ") * " + std::to_string(CELL_SIZE) + ","
+                "((cells[drawn] / " + std::to_string(COLUMNS) + ") | 0) * " + std::to_string(CELL_SIZE) + ","
+                + std::to_string(CELL_SIZE) + ", " + std::to_string(CELL_SIZE) + ");"
+          "}"
+          "el.naviFrame = drawn < cells.length ? requestAnimationFrame(frame) : null;"
+        "}"
+        "frame();"
+        "}");
+    clicked().connect([=](const WMouseEvent& event) {
+        int row = event.widget().y / CELL_SIZE;
+        int col = event.widget().x / CELL_SIZE;
+        if(row >= 0 && row < ROWS && col >= 0 && col < COLUMNS) {
+            cellClicked_.emit(row, col);
+        }
+    });
+}
+
+/**
+* Signal emitted with the row and column of the cell the user clicked.
+* @return cellClicked: the click signal.
+*/
+Signal<int, int>& CampusMapWidget::cellClicked()
+{
+    return cellClicked_;
+}
+
+/**
+* Highlight a building as the start building. The repaint clears the canvas, so a trace still being
+* animated is stopped instead of being drawn on over the new picture.
+* @param buildingId: the dictionary index of the building, -1 for none.
+*/
+void CampusMapWidget::setStartBuilding(int buildingId)
+{
+    startBuildingId_ = buildingId;
+    doJavaScript(jsRef() + ".naviStop();");
+    update();
+}
+
+/**
+* Highlight a building as the target building, stopping the animation of a trace like setStartBuilding.
+* @param buildingId: the dictionary index of the building, -1 for none.
+*/
+void CampusMapWidget::setTargetBuilding(int buildingId)
+{
+    targetBuildingId_ = buildingId;
+    doJavaScript(jsRef() + ".naviStop();");
+    update();
+}
+
+/**
+* Animate a search in the browser. Both lists are sent in one small update and drawn
+* by the client, the server keeps no state for them.
+* @param visitedCells: the visited cells in visiting order.
+* @param shortestPath: the path from the start to the target.
+*/
+void CampusMapWidget::animateTrace(const std::vector<std::pair<int, int>>& visitedCells, const std::vector<std::pair<int, int>>& shortestPath)
+{
+    doJavaScript(jsRef() + ".naviAnimate(" + TraceEncoder::encode(visitedCells, COLUMNS) + "," + TraceEncoder::encode(shortestPath, COLUMNS) + ");");
+}
+
+/**
+* Remove every overlay and go back to the bare campus picture.
+*/
+void CampusMapWidget::clearOverlays()
+{
+    startBuildingId_ = -1;
+    targetBuildingId_ = -1;
+    doJavaScript(jsRef() + ".naviStop();");
+    update();
+}
+
+/**
+* Paint event method: draws the selected buildings, one filled path per building.
+* @param paintDevice: the device to paint on.
+*/
+void CampusMapWidget::paintEvent(WPaintDevice* paintDevice)
+{
+    WPainter painter(paintDevice);
+    painter.setPen(WPen(PenStyle::None));
+    fillBuilding(painter, startBuildingId_, WColor(50, 205, 50, 128));
+    fillBuilding(painter, targetBuildingId_, WColor(220, 20, 60, 128));
+}
+
+/**
+* Fill the footprint of a building, one rectangle per row span.
+* @param painter: the painter to draw with.
+* @param buildingId: the dictionary index of the building, nothing is drawn for -1.
+* @param color: the fill colour.
+*/
+void CampusMapWidget::fillBuilding(WPainter& painter, int buildingId, const WColor& color)
+{
+    if(buildingId == -1) {
+        return;
+    }
+    WPainterPath path;
+    for(const FootprintSpan& span: dictionary_->getBuilding(buildingId).getFootprint()) {
+        path.addRect(span.colBegin * CELL_SIZE, span.row * CELL_SIZE, (span.colEnd - span.colBegin + 1) * CELL_SIZE, CELL_SIZE);
+    }
+    painter.fillPath(path, WBrush(color));
+}
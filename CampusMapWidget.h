@@ -0,0 +1,51 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: To draw the campus map as one painted widget instead of a table of cells.
+*/
+#ifndef CAMPUSMAP_WIDGET_H
+#define CAMPUSMAP_WIDGET_H
+
+#include <Wt/WPaintedWidget.h>
+#include <Wt/WPaintDevice.h>
+#include <Wt/WPainter.h>
+#include <Wt/WSignal.h>
+#include <Wt/WEvent.h>
+#include <vector>
+#include "BuildingDictionary.h"
+
+using namespace Wt;
+
+/**
+* The campus board. The campus picture is the base layer and comes from the static
+* docroot image set by the "campus-board" style class, so every session shares the same
+* cached file. The server only draws the selected buildings on top of it. The visited cells
+* and the shortest path are sent once as a compact trace and animated in the browser.
+*/
+class CampusMapWidget: public WPaintedWidget
+{
+    public:
+        static const int ROWS = 200;
+        static const int COLUMNS = 168;
+        static const int CELL_SIZE = 4;
+
+        CampusMapWidget(const BuildingDictionary* dictionary);
+        Signal<int, int>& cellClicked();
+        void setStartBuilding(int buildingId);
+        void setTargetBuilding(int buildingId);
+        void animateTrace(const std::vector<std::pair<int, int>>& visitedCells, const std::vector<std::pair<int, int>>& shortestPath);
+        void clearOverlays();
+
+    protected:
+        void paintEvent(WPaintDevice* paintDevice);
+
+    private:
+        const BuildingDictionary            *dictionary_;
+        Signal<int, int>                    cellClicked_;
+        int                                 startBuildingId_;
+        int                                 targetBuildingId_;
+
+        void fillBuilding(WPainter& painter, int buildingId, const WColor& color);
+};
+
+#endif
@@ -0,0 +1,425 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: Graph of the junctions of a map, with every corridor between two junctions as one edge.
+*/
+
+#include "ChainGraph.h"
+#include <algorithm>
+#include "MapSnapshot.h"
+
+// a GraphView node that is not yet a junction or inside a corridor, while the chains are built
+static const int UNPLACED = -1;
+
+/**
+* Finds the junctions of a graph, contracts the corridors between them and customizes the costs.
+* @param graph: the walkable blocks of the map.
+*/
+void ChainGraph::build(const GraphView& graph) {
+    int nodes = graph.getNodeCount();
+    std::vector<int>& junctions = junctionNodes.owned();
+    std::vector<int>& placed = place.owned();
+    std::vector<Chain>& corridors = chains.owned();
+    junctions.clear();
+    chainNodes.owned().clear();
+    slotChains.owned().clear();
+    corridors.clear();
+    placed.assign(nodes, UNPLACED);
+    int neighbours[4];
+    for(int node = 0; node < nodes; node++) {
+        if(graph.getNeighbours(node, neighbours) != 2) {
+            placed[node] = junctions.size();
+            junctions.push_back(node);
+        }
+    }
+    int found = junctions.size();
+    for(int junction = 0; junction < found; junction++) {
+        walkCorridors(graph, junction);
+    }
+    // a corridor closed on itself has no junction, one of its blocks becomes one
+    for(int node = 0; node < nodes; node++) {
+        if(placed[node] == UNPLACED) {
+            placed[node] = junctions.size();
+            junctions.push_back(node);
+            walkCorridors(graph, placed[node]);
+        }
+    }
+
+    // every corridor is an edge in both directions
+    std::vector<int>& offsets = edgeOffsets.owned();
+    offsets.assign(junctions.size() + 1, 0);
+    for(const Chain& chain: corridors) {
+        offsets[chain.from + 1]++;
+        offsets[chain.to + 1]++;
+    }
+    for(size_t junction = 1; junction < offsets.size(); junction++) {
+        offsets[junction] += offsets[junction - 1];
+    }
+    edges.resize(corridors.size() * 2);
+    std::vector<int> next(offsets.begin(), offsets.end() - 1);
+    for(size_t index = 0; index < corridors.size(); index++) {
+        const Chain& chain = corridors[index];
+        edges[next[chain.from]++] = {chain.to, 0, (int) index * 2 + 1};
+        edges[next[chain.to]++] = {chain.from, 0, (int) index * 2};
+    }
+    for(TableView<int>* table: {&junctionNodes, &place, &chainNodes, &slotChains, &edgeOffsets}) {
+        table->useOwned();
+    }
+    chains.useOwned();
+    customize(graph);
+}
+
+/**
+* Writes the junctions, corridors and edges to a snapshot, which depend only on the walls.
+* @param out: the snapshot being written.
+*/
+void ChainGraph::saveTables(SnapshotWriter& out) const {
+    for(const TableView<int>* table: {&junctionNodes, &place, &chainNodes, &slotChains, &edgeOffsets}) {
+        out.append(table->begin(), table->size());
+    }
+    out.append(chains.begin(), chains.size());
+    out.append(edges.data(), edges.size());
+}
+
+/**
+* Uses the tables of a snapshot written by saveTables for a graph with the same walls. The costs are left
+* to customize, which must be called before the first search.
+* @param in: the snapshot, after the tables of the graph.
+* @param graph: the graph of the map, mapped from the same snapshot.
+* @return true if the tables were read and fit the graph, false if the chains must be built.
+*/
+bool ChainGraph::mapTables(SnapshotReader& in, const GraphView& graph) {
+    const int* data[5];
+    std::size_t sizes[5];
+    const Chain* corridors;
+    const ChainEdge* chainEdges;
+    std::size_t corridorCount, edgeCount;
+    for(int i = 0; i < 5; i++) {
+        if(!in.next(data[i], sizes[i])) {
+            return false;
+        }
+    }
+    if(!in.next(corridors, corridorCount) || !in.next(chainEdges, edgeCount) || sizes[1] != (std::size_t) graph.getNodeCount()
+       || sizes[2] != sizes[3] || sizes[4] != sizes[0] + 1 || edgeCount != corridorCount * 2) {
+        return false;
+    }
+    TableView<int>* tables[] = {&junctionNodes, &place, &chainNodes, &slotChains, &edgeOffsets};
+    for(int i = 0; i < 5; i++) {
+        tables[i]->useMapped(data[i], sizes[i]);
+    }
+    chains.useMapped(corridors, corridorCount);
+    edges.assign(chainEdges, chainEdges + edgeCount);
+    prefix.resize(chainNodes.size());
+    closedPrefix.resize(chainNodes.size());
+    return true;
+}
+
+/**
+* Fills in the costs of the corridors and edges from the weights of the graph they were built from, after
+* weights changed or blocks were closed. The walls must be the same as when the graph was built.
+* @param graph: the walkable blocks of the map.
+*/
+void ChainGraph::customize(const GraphView& graph) {
+    prefix.resize(chainNodes.size());
+    closedPrefix.resize(chainNodes.size());
+    for(const Chain& chain: chains) {
+        int weight = 0;
+        int closed = 0;
+        for(int slot = chain.first; slot < chain.end; slot++) {
+            int blockWeight = graph.getWeight(chainNodes[slot]);
+            weight += blockWeight;
+            closed += blockWeight == GraphView::CLOSED;
+            prefix[slot] = weight;
+            closedPrefix[slot] = closed;
+        }
+    }
+    // entering the far junction is part of the cost of an edge
+    for(ChainEdge& edge: edges) {
+        const Chain& chain = chains[edge.chain >> 1];
+        int to = junctionNodes[edge.to];
+        if(closedUpTo(chain, chain.end - 1) > 0 || graph.getWeight(to) == GraphView::CLOSED) {
+            edge.cost = CLOSED_LINK;
+        } else {
+            edge.cost = (chain.end > chain.first ? prefix[chain.end - 1] : 0) + graph.getWeight(to);
+        }
+    }
+}
+
+/**
+* Walks every corridor leaving a junction that was not walked from its other end yet.
+* @param graph: the walkable blocks of the map.
+* @param junction: the junction.
+*/
+void ChainGraph::walkCorridors(const GraphView& graph, int junction) {
+    std::vector<int>& placed = place.owned();
+    std::vector<int>& slots = chainNodes.owned();
+    std::vector<Chain>& corridors = chains.owned();
+    int node = junctionNodes.owned()[junction];
+    int neighbours[4];
+    int count = graph.getNeighbours(node, neighbours);
+    for(int i = 0; i < count; i++) {
+        int next = neighbours[i];
+        if(placed[next] >= 0) {
+            // neighbouring junctions, joined once from the lower of the two
+            if(node < next) {
+                corridors.push_back({junction, placed[next], (int) slots.size(), (int) slots.size()});
+            }
+            continue;
+        }
+        if(placed[next] != UNPLACED) {
+            // walked from the other end
+            continue;
+        }
+        int chain = corridors.size();
+        int first = slots.size();
+        int prev = node;
+        while(placed[next] == UNPLACED) {
+            placed[next] = -2 - (int) slots.size();
+            slots.push_back(next);
+            slotChains.owned().push_back(chain);
+            int around[4];
+            graph.getNeighbours(next, around);
+            int following = around[0] == prev ? around[1] : around[0];
+            prev = next;
+            next = following;
+        }
+        corridors.push_back({junction, placed[next], first, (int) slots.size()});
+    }
+}
+
+/**
+* Bytes used by the chains, without the tables mapped from a snapshot, which are shared.
+* @return bytes: the memory of the junctions, the corridors and the edges.
+*/
+long ChainGraph::getMemoryBytes() const {
+    return sizeof(ChainGraph) + junctionNodes.getOwnedBytes() + place.getOwnedBytes() + chainNodes.getOwnedBytes() + slotChains.getOwnedBytes()
+        + edgeOffsets.getOwnedBytes() + chains.getOwnedBytes() + (prefix.capacity() + closedPrefix.capacity()) * sizeof(int)
+        + edges.capacity() * sizeof(ChainEdge);
+}
+
+/**
+* Finds the search nodes of the starts and targets of a query.
+* @param query: the query, with startNodes and targetNodes filled.
+*/
+void ChainGraph::placeQuery(ChainQuery& query) const {
+    query.junctions = junctionNodes.size();
+    query.starts.clear();
+    query.targets.clear();
+    query.ends.clear();
+    for(const std::vector<int>* nodes: {&query.startNodes, &query.targetNodes}) {
+        for(int node: *nodes) {
+            if(place[node] < 0) {
+                int slot = -2 - place[node];
+                query.ends.push_back({node, slotChains[slot], slot});
+            }
+        }
+    }
+    // in walking order along each corridor, a block that is a start or target more than once gets one search node
+    std::sort(query.ends.begin(), query.ends.end(), [](const ChainEnd& a, const ChainEnd& b) {
+        return a.chain < b.chain || (a.chain == b.chain && a.slot < b.slot);
+    });
+    query.ends.erase(std::unique(query.ends.begin(), query.ends.end(), [](const ChainEnd& a, const ChainEnd& b) {
+        return a.node == b.node;
+    }), query.ends.end());
+    for(int node: query.startNodes) {
+        query.starts.push_back(findSearchNode(query, node));
+    }
+    for(int node: query.targetNodes) {
+        query.targets.push_back(findSearchNode(query, node));
+    }
+}
+
+/**
+* Finds the search node of a start or target of a placed query.
+* @param query: the query.
+* @param node: the start or target in the GraphView.
+* @return searchNode: its junction, or its search node after the junctions inside a corridor.
+*/
+int ChainGraph::findSearchNode(const ChainQuery& query, int node) const {
+    if(place[node] >= 0) {
+        return place[node];
+    }
+    int slot = -2 - place[node];
+    auto found = std::lower_bound(query.ends.begin(), query.ends.end(), slot, [this](const ChainEnd& end, int value) {
+        return end.chain < slotChains[value] || (end.chain == slotChains[value] && end.slot < value);
+    });
+    return query.junctions + (found - query.ends.begin());
+}
+
+/**
+* Finds where an edge leads when starts or targets may be inside its corridor: the nearest of them, or
+* the junction at the other end if there are none.
+* @param graph: the graph the chains were built from.
+* @param query: the search.
+* @param edge: the edge.
+* @return link: the way out along the edge.
+*/
+ChainLink ChainGraph::getCorridorLink(const GraphView& graph, const ChainQuery& query, int edge) const {
+    const ChainEdge& chainEdge = edges[edge];
+    int index = chainEdge.chain >> 1;
+    const Chain& chain = chains[index];
+    auto byChain = [](const ChainEnd& end, int value) {
+        return end.chain < value;
+    };
+    auto first = std::lower_bound(query.ends.begin(), query.ends.end(), index, byChain);
+    if(first == query.ends.end() || first->chain != index) {
+        return {chainEdge.to, chainEdge.cost, edge};
+    }
+    if(chainEdge.chain & 1) {
+        int cost = closedUpTo(chain, first->slot) > 0 ? CLOSED_LINK : prefix[first->slot];
+        return {query.junctions + (int) (first - query.ends.begin()), cost, edge};
+    }
+    // walked from the to junction, the last one in the corridor is the nearest
+    auto last = std::lower_bound(first, query.ends.end(), index + 1, byChain) - 1;
+    int cost = prefix[chain.end - 1] - prefix[last->slot] + graph.getWeight(chainNodes[last->slot]);
+    if(closedUpTo(chain, chain.end - 1) > closedUpTo(chain, last->slot - 1)) {
+        cost = CLOSED_LINK;
+    }
+    return {query.junctions + (int) (last - query.ends.begin()), cost, edge};
+}
+
+/**
+* Finds the ways out of a start or target inside a corridor: along the corridor in both directions, to the
+* next start or target or else to the junction at the end. A way that enters a closed block is left out.
+* @param graph: the graph the chains were built from.
+* @param query: the search.
+* @param end: the start or target, an index of query.ends.
+* @param links: filled with the ways out.
+* @return count: the number of links.
+*/
+int ChainGraph::getEndLinks(const GraphView& graph, const ChainQuery& query, int end, ChainLink links[MAX_LINKS]) const {
+    const ChainEnd& here = query.ends[end];
+    const Chain& chain = chains[here.chain];
+    int count = 0;
+    int closedHere = closedUpTo(chain, here.slot);
+    if(end + 1 < (int) query.ends.size() && query.ends[end + 1].chain == here.chain) {
+        int slot = query.ends[end + 1].slot;
+        if(closedUpTo(chain, slot) == closedHere) {
+            links[count++] = {query.junctions + end + 1, prefix[slot] - prefix[here.slot], viaEnd(end, TOWARD_TO)};
+        }
+    } else if(closedUpTo(chain, chain.end - 1) == closedHere && graph.getWeight(junctionNodes[chain.to]) != GraphView::CLOSED) {
+        links[count++] = {chain.to, prefix[chain.end - 1] - prefix[here.slot] + graph.getWeight(junctionNodes[chain.to]), viaEnd(end, TOWARD_TO)};
+    }
+    // the weights and closed blocks between the from junction and this one
+    int before = prefix[here.slot] - graph.getWeight(chainNodes[here.slot]);
+    int closedBefore = closedUpTo(chain, here.slot - 1);
+    if(end > 0 && query.ends[end - 1].chain == here.chain) {
+        int slot = query.ends[end - 1].slot;
+        if(closedUpTo(chain, slot - 1) == closedBefore) {
+            links[count++] = {query.junctions + end - 1, before - (prefix[slot] - graph.getWeight(chainNodes[slot])), viaEnd(end, TOWARD_FROM)};
+        }
+    } else if(closedBefore == 0 && graph.getWeight(junctionNodes[chain.from]) != GraphView::CLOSED) {
+        links[count++] = {chain.from, before + graph.getWeight(junctionNodes[chain.from]), viaEnd(end, TOWARD_FROM)};
+    }
+    return count;
+}
+
+/**
+* Adds the blocks of corridor slots to a path.
+* @param graph: the graph the chains were built from.
+* @param from: the first slot added.
+* @param to: the slot after the last one added, in the direction of the walk.
+* @param path: the path.
+*/
+void ChainGraph::appendSlots(const GraphView& graph, int from, int to, std::vector<std::pair<int, int>>& path) const {
+    int step = to > from ? 1 : -1;
+    for(int slot = from; slot != to; slot += step) {
+        path.push_back(std::make_pair(graph.getRow(chainNodes[slot]), graph.getColumn(chainNodes[slot])));
+    }
+}
+
+/**
+* Finds the search node a link leaves from.
+* @param query: the search.
+* @param via: the link, as stored in the prev of the node it leads to.
+* @return searchNode: the search node the link was walked from.
+*/
+int ChainGraph::getLinkSource(const ChainQuery& query, int via) const {
+    if(via >= 0) {
+        const Chain& chain = chains[edges[via].chain >> 1];
+        return edges[via].chain & 1 ? chain.from : chain.to;
+    }
+    return query.junctions + (-2 - via) / 2;
+}
+
+/**
+* Adds the blocks inside a link to a path, walked back from the search node the link leads to.
+* @param graph: the graph the chains were built from.
+* @param query: the search.
+* @param searchNode: the search node the link leads to.
+* @param via: the link.
+* @param path: the blocks between the two search nodes are added at its end, the nearest to searchNode first.
+*/
+void ChainGraph::appendLink(const GraphView& graph, const ChainQuery& query, int searchNode, int via,
+                            std::vector<std::pair<int, int>>& path) const {
+    // the corridor walked to this node, the direction and the slot it was walked from
+    int index;
+    bool forward;
+    int sourceSlot;
+    if(via >= 0) {
+        index = edges[via].chain >> 1;
+        forward = edges[via].chain & 1;
+        sourceSlot = forward ? chains[index].first - 1 : chains[index].end;
+    } else {
+        int end = (-2 - via) / 2;
+        index = query.ends[end].chain;
+        forward = (-2 - via) % 2 == TOWARD_TO;
+        sourceSlot = query.ends[end].slot;
+    }
+    const Chain& chain = chains[index];
+    int slot;
+    if(searchNode >= query.junctions) {
+        slot = query.ends[searchNode - query.junctions].slot;
+    } else {
+        slot = forward ? chain.end : chain.first - 1;
+    }
+    appendSlots(graph, forward ? slot - 1 : slot + 1, sourceSlot, path);
+}
+
+/**
+* Adds the blocks of the path a search found to a target, walked back over the prev of every search node
+* and expanded back into the blocks of the corridors it went through.
+* @param graph: the graph the chains were built from.
+* @param query: the search.
+* @param state: the state the search left.
+* @param target: the search node of a target the search reached.
+* @param path: the path, the blocks from the start to the target are added at its end.
+*/
+void ChainGraph::appendPath(const GraphView& graph, const ChainQuery& query, const SearchState& state, int target,
+                            std::vector<std::pair<int, int>>& path) const {
+    size_t begin = path.size();
+    int searchNode = target;
+    while(true) {
+        int node = getNode(query, searchNode);
+        path.push_back(std::make_pair(graph.getRow(node), graph.getColumn(node)));
+        int via = state.getPrev(searchNode);
+        if(via == -1) {
+            break;
+        }
+        appendLink(graph, query, searchNode, via, path);
+        searchNode = getLinkSource(query, via);
+    }
+    std::reverse(path.begin() + begin, path.end());
+}
+
+/**
+* Adds the blocks a search went through to reach a search node it expands: the blocks inside the corridor
+* it was reached over, in walking order, then the block of the node. The visited blocks of a search are
+* then block by block, as the browser animates them and the route cache checks them against new walls.
+* @param graph: the graph the chains were built from.
+* @param query: the search.
+* @param state: the state of the search, in which the node has its final prev.
+* @param searchNode: the search node expanded.
+* @param visited: the visited blocks, the blocks are added at its end.
+*/
+void ChainGraph::appendReached(const GraphView& graph, const ChainQuery& query, const SearchState& state, int searchNode,
+                               std::vector<std::pair<int, int>>& visited) const {
+    size_t begin = visited.size();
+    int node = getNode(query, searchNode);
+    visited.push_back(std::make_pair(graph.getRow(node), graph.getColumn(node)));
+    int via = state.getPrev(searchNode);
+    if(via != -1) {
+        appendLink(graph, query, searchNode, via, visited);
+    }
+    std::reverse(visited.begin() + begin, visited.end());
+}
@@ -0,0 +1,190 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: Graph of the junctions of a map, with every corridor between two junctions as one edge.
+*/
+
+#ifndef CHAINGRAPH_H
+#define CHAINGRAPH_H
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include "GraphView.h"
+#include "SearchState.h"
+#include "TableView.h"
+
+/**
+* A start or target inside a corridor, which gets a search node of its own after the junctions.
+*/
+struct ChainEnd {
+    // the node in the GraphView
+    int node;
+    int chain;
+    // the slot of the block in the corridor, see ChainGraph
+    int slot;
+};
+
+/**
+* A way out of a search node: the node it leads to, the cost of getting there and how it is walked back,
+* which the search stores as the prev of the node.
+*/
+struct ChainLink {
+    int node;
+    int cost;
+    int via;
+};
+
+/**
+* The starts and targets of one search on a ChainGraph. The caller fills startNodes and targetNodes
+* with nodes of the GraphView and places the query with ChainGraph::placeQuery, which finds the search
+* nodes of every start and target. A query is kept in the SearchWorkspace and reused, so placing it
+* allocates nothing once the thread placed one as large.
+*/
+struct ChainQuery {
+    std::vector<int> startNodes;
+    std::vector<int> targetNodes;
+    // the search nodes of startNodes and targetNodes, in the same order
+    std::vector<int> starts;
+    std::vector<int> targets;
+    // the number of junctions: search node junctions + i is ends[i]
+    int junctions = 0;
+    // the starts and targets inside corridors, by corridor and slot
+    std::vector<ChainEnd> ends;
+};
+
+/**
+* The walkable blocks of a map with every run of blocks that have exactly two walkable neighbours,
+* a one block wide corridor, contracted into a single weighted edge between the blocks at its ends.
+* The blocks a search expands are the junctions: the blocks with more or fewer than two neighbours,
+* plus one block of every corridor that is a closed loop. The blocks inside the corridors are kept in
+* walking order, so a path over the junctions is expanded back into blocks by appendPath.
+*
+* Only the walls decide the junctions and corridors. The costs come from the weights of the GraphView and
+* are filled in by customize, which takes one pass over the blocks, so a change of weights or a closed block
+* does not build the graph again. A link that enters a block closed with GraphView::CLOSED is left out.
+* The junctions and corridors may also be mapped from a MapSnapshot, see mapTables.
+*/
+class ChainGraph {
+    public:
+        // the most links of a search node, a junction has up to four neighbours
+        static const int MAX_LINKS = 4;
+
+        void build(const GraphView& graph);
+        void saveTables(SnapshotWriter& out) const;
+        bool mapTables(SnapshotReader& in, const GraphView& graph);
+        void customize(const GraphView& graph);
+        long getMemoryBytes() const;
+        void placeQuery(ChainQuery& query) const;
+        void appendPath(const GraphView& graph, const ChainQuery& query, const SearchState& state, int target,
+                        std::vector<std::pair<int, int>>& path) const;
+        void appendReached(const GraphView& graph, const ChainQuery& query, const SearchState& state, int searchNode,
+                           std::vector<std::pair<int, int>>& visited) const;
+        int getLinkSource(const ChainQuery& query, int via) const;
+        void appendLink(const GraphView& graph, const ChainQuery& query, int searchNode, int via,
+                        std::vector<std::pair<int, int>>& path) const;
+
+        int getJunctionCount() const {
+            return junctionNodes.size();
+        }
+        // search nodes of a placed query, the junctions and the starts and targets inside corridors
+        int getSearchNodeCount(const ChainQuery& query) const {
+            return junctionNodes.size() + query.ends.size();
+        }
+        // the node in the GraphView of a search node
+        int getNode(const ChainQuery& query, int searchNode) const {
+            if(searchNode >= query.junctions) {
+                return query.ends[searchNode - query.junctions].node;
+            }
+            return junctionNodes[searchNode];
+        }
+        /**
+        * Finds the ways out of a search node. The starts and targets inside a corridor split it: a
+        * corridor leads to the nearest of them, which lead on to the next one or to the end of the corridor.
+        * @param graph: the graph the chains were built from.
+        * @param query: the search.
+        * @param searchNode: the search node.
+        * @param links: filled with the ways out.
+        * @return count: the number of links.
+        */
+        int getLinks(const GraphView& graph, const ChainQuery& query, int searchNode, ChainLink links[MAX_LINKS]) const {
+            if(searchNode >= query.junctions) {
+                return getEndLinks(graph, query, searchNode - query.junctions, links);
+            }
+            int lowest = query.ends.empty() ? -1 : query.ends.front().chain;
+            int highest = query.ends.empty() ? -2 : query.ends.back().chain;
+            int count = 0;
+            int last = edgeOffsets[searchNode + 1];
+            for(int edge = edgeOffsets[searchNode]; edge < last; edge++) {
+                const ChainEdge& chainEdge = edges[edge];
+                int chain = chainEdge.chain >> 1;
+                if(chain < lowest || chain > highest) {
+                    if(chainEdge.cost != CLOSED_LINK) {
+                        links[count++] = {chainEdge.to, chainEdge.cost, edge};
+                    }
+                } else {
+                    ChainLink link = getCorridorLink(graph, query, edge);
+                    if(link.cost != CLOSED_LINK) {
+                        links[count++] = link;
+                    }
+                }
+            }
+            return count;
+        }
+    private:
+        // the way a start or target inside a corridor leaves it, see viaEnd
+        static const int TOWARD_TO = 0;
+        static const int TOWARD_FROM = 1;
+        // the cost of a link that enters a closed block
+        static const int CLOSED_LINK = -1;
+
+        /**
+        * A corridor, walked from the junction from to the junction to over chainNodes[first] to
+        * chainNodes[end - 1]. Neighbouring junctions are joined by a corridor with no blocks.
+        */
+        struct Chain {
+            int from;
+            int to;
+            int first;
+            int end;
+        };
+        struct ChainEdge {
+            int to;
+            int cost;
+            // the corridor times two, plus one when it is walked from its from junction
+            int chain;
+        };
+
+        // the GraphView node of every junction
+        TableView<int> junctionNodes;
+        // the junction of every GraphView node, or -2 - its slot in chainNodes inside a corridor
+        TableView<int> place;
+        // the blocks inside the corridors, the corridor of each, and the weights and closed blocks summed from the
+        // start of its corridor
+        TableView<int> chainNodes;
+        TableView<int> slotChains;
+        std::vector<int> prefix;
+        std::vector<int> closedPrefix;
+        TableView<Chain> chains;
+        // the edges of each junction, two per corridor, with the costs of the map
+        TableView<int> edgeOffsets;
+        std::vector<ChainEdge> edges;
+
+        void walkCorridors(const GraphView& graph, int junction);
+        int findSearchNode(const ChainQuery& query, int node) const;
+        ChainLink getCorridorLink(const GraphView& graph, const ChainQuery& query, int edge) const;
+        int getEndLinks(const GraphView& graph, const ChainQuery& query, int end, ChainLink links[MAX_LINKS]) const;
+        void appendSlots(const GraphView& graph, int from, int to, std::vector<std::pair<int, int>>& path) const;
+
+        // closed blocks of a corridor from its start up to and with a slot, which may be the one before the first
+        int closedUpTo(const Chain& chain, int slot) const {
+            return slot < chain.first ? 0 : closedPrefix[slot];
+        }
+
+        // the prev of a node reached from query.ends[end], always below -1
+        static int viaEnd(int end, int way) {
+            return -2 - (end * 2 + way);
+        }
+};
+
+#endif
@@ -7,16 +7,18 @@
 #define DIJKSTRA_H
 
 #pragma once
-#include <queue>
 #include <unistd.h>
 #include <vector>
 #include "Algorithm.h"
 #include "Block.h"
+#include "ChainGraph.h"
+#include "GraphView.h"
+#include "SearchWorkspace.h"
 
 struct dijkstracompare {
-   bool operator()(Block* const& a,Block* const& b)
+   bool operator()(const FrontierEntry& a, const FrontierEntry& b) const
    {
-       return a->getMinDistance() > b->getMinDistance();
+       return a.cost > b.cost;
    }
 };
 
@@ -26,15 +28,12 @@ class Dijkstra : public Algorithm
         Dijkstra(Board* board) { 
             currentBoard = board;
         }
-        std::pair<std::vector<std::pair<int, int>>, std::vector<std::pair<int, int>>> runAlgorithm();
+        const std::pair<std::vector<std::pair<int, int>>, std::vector<std::pair<int, int>>>& runAlgorithm();
+        const std::vector<NearestRoute>& findNearest(const std::pair<int, int>& start, const std::vector<std::pair<int, int>>& targets, int count);
+        const std::pair<std::vector<std::pair<int, int>>, std::vector<std::pair<int, int>>>& findRoute(const std::vector<std::pair<int, int>>& starts,
+                                                                                                     const std::vector<std::pair<int, int>>& targets);
     private:
-        int distance = 0;
-        std::vector<Block*> visited;
-        std::priority_queue<Block*, std::vector<Block*>, dijkstracompare> unvisited;
-        void addNeighboursToUnvisited(Block* node);
-        void reorderPriorityQueue(Block* node);
-        std::pair<std::vector<std::pair<int, int>>, std::vector<std::pair<int, int>>> findShortestPathOnMap(Block* startLoc, Block* targetLoc);
-        std::vector<Block*> sortByWeight(std::vector<Block*> connections);
-        void calculateShortestDistance(Block* currNode, std::vector<Block*> connections);
+        void addNeighboursToUnvisited(const GraphView& graph, const ChainGraph& chains, const ChainQuery& query, SearchWorkspace& workspace, int node);
+        void findShortestPathOnMap(const GraphView& graph, const ChainGraph& chains, SearchWorkspace& workspace, int count);
 };
 #endif
@@ -0,0 +1,659 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: Differential fuzzing of every pathfinding algorithm against a reference Dijkstra.
+*
+* Usage: naviFuzz [--seed n] [--cases n] [--baseline file] [--update-baseline] [--tolerance percent]
+* Every case is a random map with walls and weights and a few random queries on it, asked again after walls
+* are added and removed. Each algorithm of the factory must find a route exactly when the reference does, with
+* the same cost, and the route must be a chain of neighbouring open blocks from the start to the target. The
+* algorithms run without the route cache, and every route query, between blocks or sets of blocks, is asked
+* once more through it, where the same must hold for the routes it keeps over the edits and no visited block
+* may be a wall. Every case also asks for the nearest of a
+* few targets, which must be the nearest ones by the reference costs, for a route between two sets of
+* blocks, which must be as cheap as the cheapest pair of them, and for a few alternative routes between two
+* blocks, which on small maps must cost what the cheapest of all their loopless routes cost. The first queries
+* are asked once more under overlays that close blocks and change weights. The expansions of every algorithm
+* are summed and compared with the baseline file, so a search that got slower fails the run like a wrong answer.
+*/
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+#include "AlgorithmFactory.h"
+#include "LogicServer.h"
+
+// number of failing maps printed in full, the others are only counted
+static const int MAX_DUMPS = 3;
+// the most open blocks of a map whose loopless routes are all listed for the alternatives check
+static const int MAX_LISTED_BLOCKS = 14;
+
+/**
+* A random map in plain arrays, independent of the engine.
+*/
+struct FuzzMap {
+    int rows;
+    int cols;
+    // true for walls, row by row
+    std::vector<bool> walls;
+    // the cost of entering each block, 0 for a block closed by an overlay
+    std::vector<int> weights;
+};
+
+/**
+* Returns a random number in [0, bound). Uses the generator output directly so that a seed gives the same
+* maps with every standard library, which keeps the expansion baseline comparable between machines.
+* @param random: the random generator.
+* @param bound: the number of possible values.
+* @return value: the random number.
+*/
+static int randomBelow(std::mt19937& random, int bound) {
+    return random() % bound;
+}
+
+/**
+* Creates a random map: sizes from a single block up to 40 by 40, up to 45% walls and some weighted blocks.
+* @param random: the random generator.
+* @return map: the new map.
+*/
+static FuzzMap randomMap(std::mt19937& random) {
+    FuzzMap map;
+    map.rows = 1 + randomBelow(random, 40);
+    map.cols = 1 + randomBelow(random, 40);
+    int wallPercent = randomBelow(random, 46);
+    int weightPercent = randomBelow(random, 4) == 0 ? 0 : randomBelow(random, 60);
+    for(int i = 0; i < map.rows * map.cols; i++) {
+        map.walls.push_back(randomBelow(random, 100) < wallPercent);
+        map.weights.push_back(randomBelow(random, 100) < weightPercent ? 2 + randomBelow(random, 8) : 1);
+    }
+    return map;
+}
+
+/**
+* Reference shortest path cost: a plain Dijkstra over the arrays, the cost of a route being the weights
+* of every block entered after the start.
+* @param map: the map.
+* @param starts: indexes of the start blocks, walls are left out.
+* @param targets: indexes of the target blocks.
+* @return cost: the cost of the shortest route from any start to any target, -1 if no target can be reached.
+*/
+static long referenceCost(const FuzzMap& map, const std::vector<int>& starts, const std::vector<int>& targets) {
+    std::vector<long> dist(map.rows * map.cols, -1);
+    std::priority_queue<std::pair<long, int>, std::vector<std::pair<long, int>>, std::greater<std::pair<long, int>>> queue;
+    for(int start: starts) {
+        if(!map.walls[start]) {
+            dist[start] = 0;
+            queue.push(std::make_pair(0L, start));
+        }
+    }
+    while(!queue.empty()) {
+        long d = queue.top().first;
+        int index = queue.top().second;
+        queue.pop();
+        if(d != dist[index]) {
+            continue;
+        }
+        if(std::find(targets.begin(), targets.end(), index) != targets.end()) {
+            return d;
+        }
+        int row = index / map.cols;
+        int col = index % map.cols;
+        const int moves[4][2] = {{-1, 0}, {1, 0}, {0, -1}, {0, 1}};
+        for(const auto& move: moves) {
+            int r = row + move[0];
+            int c = col + move[1];
+            if(r < 0 || c < 0 || r >= map.rows || c >= map.cols) {
+                continue;
+            }
+            int next = r * map.cols + c;
+            if(map.walls[next] || map.weights[next] == 0) {
+                continue;
+            }
+            long nd = d + map.weights[next];
+            if(dist[next] < 0 || nd < dist[next]) {
+                dist[next] = nd;
+                queue.push(std::make_pair(nd, next));
+            }
+        }
+    }
+    return -1;
+}
+
+/**
+* Lists the costs of every loopless route between two blocks by walking them all, for small maps only.
+* @param map: the map.
+* @param index: the block the routes walked so far end at.
+* @param target: index of the target block.
+* @param cost: the cost of the route walked so far.
+* @param walked: the blocks on the route walked so far.
+* @param costs: the cost of every route to the target is added to it.
+*/
+static void listRouteCosts(const FuzzMap& map, int index, int target, long cost, std::vector<bool>& walked, std::vector<long>& costs) {
+    if(index == target) {
+        costs.push_back(cost);
+        return;
+    }
+    walked[index] = true;
+    int row = index / map.cols;
+    int col = index % map.cols;
+    const int moves[4][2] = {{-1, 0}, {1, 0}, {0, -1}, {0, 1}};
+    for(const auto& move: moves) {
+        int r = row + move[0];
+        int c = col + move[1];
+        if(r < 0 || c < 0 || r >= map.rows || c >= map.cols) {
+            continue;
+        }
+        int next = r * map.cols + c;
+        if(!map.walls[next] && map.weights[next] > 0 && !walked[next]) {
+            listRouteCosts(map, next, target, cost + map.weights[next], walked, costs);
+        }
+    }
+    walked[index] = false;
+}
+
+/**
+* Checks a route returned by an algorithm and computes its cost.
+* @param map: the map.
+* @param path: the route, from a start to a target.
+* @param starts: indexes of the start blocks.
+* @param targets: indexes of the target blocks.
+* @param error: set to the reason when the route is broken.
+* @return cost: the cost of the route, -1 if it is broken.
+*/
+static long checkPath(const FuzzMap& map, const std::vector<std::pair<int, int>>& path, const std::vector<int>& starts, const std::vector<int>& targets,
+                      std::string& error) {
+    long cost = 0;
+    for(size_t i = 0; i < path.size(); i++) {
+        int row = path[i].first;
+        int col = path[i].second;
+        if(row < 0 || col < 0 || row >= map.rows || col >= map.cols) {
+            error = "step " + std::to_string(i) + " is off the map";
+            return -1;
+        }
+        if(map.walls[row * map.cols + col]) {
+            error = "step " + std::to_string(i) + " is a wall";
+            return -1;
+        }
+        if(i > 0) {
+            if(std::abs(row - path[i - 1].first) + std::abs(col - path[i - 1].second) != 1) {
+                error = "step " + std::to_string(i) + " does not touch the previous step";
+                return -1;
+            }
+            if(map.weights[row * map.cols + col] == 0) {
+                error = "step " + std::to_string(i) + " enters a closed block";
+                return -1;
+            }
+            cost += map.weights[row * map.cols + col];
+        }
+    }
+    if(std::find(starts.begin(), starts.end(), path.front().first * map.cols + path.front().second) == starts.end()) {
+        error = "the route does not begin at a start";
+        return -1;
+    }
+    if(std::find(targets.begin(), targets.end(), path.back().first * map.cols + path.back().second) == targets.end()) {
+        error = "the route does not end at a target";
+        return -1;
+    }
+    return cost;
+}
+
+/**
+* Checks the route returned by a search against the reference cost.
+* @param map: the map.
+* @param path: the route, empty if none was found.
+* @param starts: indexes of the start blocks.
+* @param targets: indexes of the target blocks.
+* @param expected: the reference cost, -1 if no target can be reached.
+* @return error: the reason the route is wrong, empty if it is right.
+*/
+static std::string checkRoute(const FuzzMap& map, const std::vector<std::pair<int, int>>& path, const std::vector<int>& starts,
+                              const std::vector<int>& targets, long expected) {
+    std::string error;
+    if(path.empty()) {
+        if(expected >= 0) {
+            error = "no route found, the reference cost is " + std::to_string(expected);
+        }
+    } else if(expected < 0) {
+        error = "a route was found but the target cannot be reached";
+    } else {
+        long cost = checkPath(map, path, starts, targets, error);
+        if(error.empty() && cost != expected) {
+            error = "route cost " + std::to_string(cost) + ", the reference cost is " + std::to_string(expected);
+        }
+    }
+    return error;
+}
+
+/**
+* Checks that a search visited no wall, which the route cache could replay after a wall was added.
+* @param map: the map.
+* @param visited: the visited blocks returned by the search.
+* @return error: the reason the visited blocks are wrong, empty if they are right.
+*/
+static std::string checkVisited(const FuzzMap& map, const std::vector<std::pair<int, int>>& visited) {
+    for(size_t i = 0; i < visited.size(); i++) {
+        int row = visited[i].first;
+        int col = visited[i].second;
+        if(row < 0 || col < 0 || row >= map.rows || col >= map.cols) {
+            return "visited block " + std::to_string(i) + " is off the map";
+        }
+        if(map.walls[row * map.cols + col]) {
+            return "visited block " + std::to_string(i) + " is a wall";
+        }
+    }
+    return "";
+}
+
+/**
+* Checks the routes returned by a search for the nearest of several targets.
+* @param map: the map.
+* @param routes: the routes, nearest first.
+* @param start: index of the start block.
+* @param targets: indexes of the target blocks.
+* @param count: how many of the targets were asked for.
+* @return error: the reason the routes are wrong, empty if they are right.
+*/
+static std::string checkNearest(const FuzzMap& map, const std::vector<NearestRoute>& routes, int start, const std::vector<int>& targets, int count) {
+    std::vector<long> expected;
+    for(size_t i = 0; i < targets.size(); i++) {
+        long cost = referenceCost(map, {start}, {targets[i]});
+        // a target given twice is found once
+        if(cost >= 0 && std::find(targets.begin(), targets.begin() + i, targets[i]) == targets.begin() + i) {
+            expected.push_back(cost);
+        }
+    }
+    std::sort(expected.begin(), expected.end());
+    expected.resize(std::min<size_t>(expected.size(), count));
+    if(routes.size() != expected.size()) {
+        return std::to_string(routes.size()) + " targets found, the reference finds " + std::to_string(expected.size());
+    }
+    for(size_t i = 0; i < routes.size(); i++) {
+        if(routes[i].target < 0 || routes[i].target >= (int) targets.size()) {
+            return "route " + std::to_string(i) + " names no target";
+        }
+        std::string error;
+        long cost = checkPath(map, routes[i].path, {start}, {targets[routes[i].target]}, error);
+        if(!error.empty()) {
+            return "route " + std::to_string(i) + ": " + error;
+        }
+        if(cost != routes[i].cost || cost != expected[i]) {
+            return "route " + std::to_string(i) + " costs " + std::to_string(cost) + ", reported " + std::to_string(routes[i].cost)
+                + ", the reference cost is " + std::to_string(expected[i]);
+        }
+    }
+    return "";
+}
+
+/**
+* Checks the alternative routes between two blocks: loopless, different from each other, cheapest first,
+* the first one as cheap as the reference and, on a map small enough to list every route, each one as
+* cheap as the route of the same rank in the list.
+* @param map: the map.
+* @param routes: the routes, cheapest first.
+* @param start: index of the start block.
+* @param target: index of the target block.
+* @param count: how many routes were asked for.
+* @param listed: true if the map is small enough to list every route.
+* @return error: the reason the routes are wrong, empty if they are right.
+*/
+static std::string checkAlternatives(const FuzzMap& map, const std::vector<NearestRoute>& routes, int start, int target, int count, bool listed) {
+    long expected = referenceCost(map, {start}, {target});
+    if(routes.empty() || expected < 0) {
+        return routes.empty() == (expected < 0) ? "" : "found " + std::to_string(routes.size()) + " routes, the reference cost is " + std::to_string(expected);
+    }
+    if((int) routes.size() > count) {
+        return std::to_string(routes.size()) + " routes found, " + std::to_string(count) + " asked for";
+    }
+    std::vector<long> costs;
+    if(listed) {
+        std::vector<bool> walked(map.rows * map.cols, false);
+        listRouteCosts(map, start, target, 0, walked, costs);
+        std::sort(costs.begin(), costs.end());
+        costs.resize(std::min<size_t>(costs.size(), count));
+        if(routes.size() != costs.size()) {
+            return std::to_string(routes.size()) + " routes found, the map has " + std::to_string(costs.size());
+        }
+    }
+    for(size_t i = 0; i < routes.size(); i++) {
+        std::string error;
+        long cost = checkPath(map, routes[i].path, {start}, {target}, error);
+        if(!error.empty()) {
+            return "route " + std::to_string(i) + ": " + error;
+        }
+        std::vector<std::pair<int, int>> blocks = routes[i].path;
+        std::sort(blocks.begin(), blocks.end());
+        if(std::adjacent_find(blocks.begin(), blocks.end()) != blocks.end()) {
+            return "route " + std::to_string(i) + " walks a block twice";
+        }
+        if(cost != routes[i].cost) {
+            return "route " + std::to_string(i) + " costs " + std::to_string(cost) + ", reported " + std::to_string(routes[i].cost);
+        }
+        long wanted = listed ? costs[i] : (i == 0 ? expected : -1);
+        if(wanted >= 0 && cost != wanted) {
+            return "route " + std::to_string(i) + " costs " + std::to_string(cost) + ", the reference cost is " + std::to_string(wanted);
+        }
+        if(i > 0 && cost < routes[i - 1].cost) {
+            return "route " + std::to_string(i) + " is cheaper than the one before it";
+        }
+        for(size_t j = 0; j < i; j++) {
+            if(routes[j].path == routes[i].path) {
+                return "routes " + std::to_string(j) + " and " + std::to_string(i) + " are the same";
+            }
+        }
+    }
+    return "";
+}
+
+/**
+* Prints a map in the text format of Board::loadCustomMap, so a failure can be replayed with navi-route.
+* Blocks closed by an overlay are printed as 0.
+* @param map: the map.
+*/
+static void dumpMap(const FuzzMap& map) {
+    for(int row = 0; row < map.rows; row++) {
+        for(int col = 0; col < map.cols; col++) {
+            int index = row * map.cols + col;
+            std::fputc(map.walls[index] ? '#' : (map.weights[index] == 1 ? '.' : '0' + map.weights[index]), stderr);
+        }
+        std::fputc('\n', stderr);
+    }
+}
+
+/**
+* Reads the expansion baseline: one "algorithm expansions" line per algorithm.
+* @param path: the baseline file.
+* @return baseline: the expansions by algorithm name, empty if there is no file.
+*/
+static std::map<std::string, long> readBaseline(const std::string& path) {
+    std::map<std::string, long> baseline;
+    std::ifstream in(path);
+    std::string name;
+    long expansions;
+    while(in >> name >> expansions) {
+        baseline[name] = expansions;
+    }
+    return baseline;
+}
+
+int main(int argc, char **argv)
+{
+    unsigned seed = 1;
+    int cases = 500;
+    std::string baselinePath = "fuzz_baseline.txt";
+    bool updateBaseline = false;
+    double tolerance = 5;
+    for(int i = 1; i < argc; i++) {
+        if(std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = std::strtoul(argv[++i], nullptr, 10);
+        } else if(std::strcmp(argv[i], "--cases") == 0 && i + 1 < argc) {
+            cases = std::max(1, std::atoi(argv[++i]));
+        } else if(std::strcmp(argv[i], "--baseline") == 0 && i + 1 < argc) {
+            baselinePath = argv[++i];
+        } else if(std::strcmp(argv[i], "--update-baseline") == 0) {
+            updateBaseline = true;
+        } else if(std::strcmp(argv[i], "--tolerance") == 0 && i + 1 < argc) {
+            tolerance = std::atof(argv[++i]);
+        } else {
+            std::fprintf(stderr, "usage: %s [--seed n] [--cases n] [--baseline file] [--update-baseline] [--tolerance percent]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    std::vector<long> expansions(AlgorithmFactory::ALGORITHM_COUNT, 0);
+    long queries = 0;
+    long failures = 0;
+    for(int n = 0; n < cases; n++) {
+        std::mt19937 random(seed * 100003u + n);
+        FuzzMap fuzzMap = randomMap(random);
+        std::vector<int> open;
+        for(int i = 0; i < fuzzMap.rows * fuzzMap.cols; i++) {
+            if(!fuzzMap.walls[i]) {
+                open.push_back(i);
+            }
+        }
+        if(open.empty()) {
+            continue;
+        }
+
+        Board board;
+        board.initCustomMap(fuzzMap.rows, fuzzMap.cols);
+        LevelMap* map = board.getMap();
+        for(int i = 0; i < fuzzMap.rows * fuzzMap.cols; i++) {
+            map->setBlockWeight(i / fuzzMap.cols, i % fuzzMap.cols, fuzzMap.weights[i]);
+            if(fuzzMap.walls[i]) {
+                map->setBlockType(i / fuzzMap.cols, i % fuzzMap.cols, 5);
+            }
+        }
+        // the algorithms are checked and counted without the route cache, and the cache against them
+        LogicServer logicServer(&board);
+        logicServer.setCacheEnabled(false);
+        LogicServer cachedServer(&board);
+        LogicServer* const servers[] = {&logicServer, &cachedServer};
+
+        // several queries on the same board, so state left over by a previous search is caught as well
+        std::vector<std::pair<int, int>> pairs;
+        for(int q = 0; q < 4; q++) {
+            pairs.push_back(std::make_pair(open[randomBelow(random, open.size())], open[randomBelow(random, open.size())]));
+        }
+        // the queries run again after two blocks became walls, which the route cache answers with the routes of the
+        // map before them that touch neither, and again after one of the walls was removed, which it cannot
+        for(int round = 0; round < 3; round++) {
+            if(round == 1) {
+                for(int w = 0; w < 2; w++) {
+                    int cell = open[randomBelow(random, open.size())];
+                    fuzzMap.walls[cell] = true;
+                    board.changeBlockInMap(cell / fuzzMap.cols, cell % fuzzMap.cols, 5);
+                }
+            } else if(round == 2) {
+                int cell = randomBelow(random, fuzzMap.rows * fuzzMap.cols);
+                fuzzMap.walls[cell] = false;
+                board.changeBlockInMap(cell / fuzzMap.cols, cell % fuzzMap.cols, 1);
+            }
+            for(int q = 0; q < (int) pairs.size(); q++) {
+                int start = pairs[q].first;
+                int target = pairs[q].second;
+                if(fuzzMap.walls[start] || fuzzMap.walls[target]) {
+                    continue;
+                }
+                long expected = referenceCost(fuzzMap, {start}, {target});
+                queries++;
+                for(int type = 0; type < AlgorithmFactory::ALGORITHM_COUNT; type++) {
+                    for(LogicServer* server: servers) {
+                        server->setAlgorithm(type, &board);
+                        map->setStartPoint(start / fuzzMap.cols, start % fuzzMap.cols);
+                        map->setTargetPoint(target / fuzzMap.cols, target % fuzzMap.cols);
+                        const std::pair<std::vector<std::pair<int, int>>, std::vector<std::pair<int, int>>>& result = server->runAlgorithm();
+                        if(server == &logicServer) {
+                            expansions[type] += logicServer.getLastStats().expansions;
+                        }
+                        std::string error = checkRoute(fuzzMap, result.second, {start}, {target}, expected);
+                        if(error.empty()) {
+                            error = checkVisited(fuzzMap, result.first);
+                        }
+                        if(!error.empty()) {
+                            failures++;
+                            std::fprintf(stderr, "case %d round %d query %d %s%s: (%d,%d) to (%d,%d): %s\n", n, round, q,
+                                         AlgorithmFactory::getAlgorithmName(type).c_str(), server == &cachedServer ? " cached" : "",
+                                         start / fuzzMap.cols, start % fuzzMap.cols, target / fuzzMap.cols, target % fuzzMap.cols, error.c_str());
+                            if(failures <= MAX_DUMPS) {
+                                dumpMap(fuzzMap);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        // the nearest of a few targets, some of them possibly walls, the start or given twice
+        int start = open[randomBelow(random, open.size())];
+        std::vector<int> targets;
+        std::vector<std::pair<int, int>> targetBlocks;
+        for(int i = 0; i < 5; i++) {
+            targets.push_back(randomBelow(random, 3) == 0 ? open[randomBelow(random, open.size())] : randomBelow(random, fuzzMap.rows * fuzzMap.cols));
+            targetBlocks.push_back(std::make_pair(targets.back() / fuzzMap.cols, targets.back() % fuzzMap.cols));
+        }
+        int count = 1 + randomBelow(random, 3);
+        if(fuzzMap.walls[start]) {
+            continue;
+        }
+        queries++;
+        for(int type = 0; type < AlgorithmFactory::ALGORITHM_COUNT; type++) {
+            logicServer.setAlgorithm(type, &board);
+            map->setStartPoint(start / fuzzMap.cols, start % fuzzMap.cols);
+            std::string error = checkNearest(fuzzMap, logicServer.findNearest(targetBlocks, count), start, targets, count);
+            if(!error.empty()) {
+                failures++;
+                std::fprintf(stderr, "case %d nearest %d %s: from (%d,%d): %s\n", n, count, AlgorithmFactory::getAlgorithmName(type).c_str(),
+                             start / fuzzMap.cols, start % fuzzMap.cols, error.c_str());
+                if(failures <= MAX_DUMPS) {
+                    dumpMap(fuzzMap);
+                }
+            }
+        }
+
+        // a route between two sets of blocks close together, like the doors of two buildings, with walls among them
+        std::vector<int> sets[2];
+        std::vector<std::pair<int, int>> setBlocks[2];
+        for(int s = 0; s < 2; s++) {
+            int centre = open[randomBelow(random, open.size())];
+            int size = 1 + randomBelow(random, 12);
+            for(int i = 0; i < size; i++) {
+                int row = std::min(std::max(centre / fuzzMap.cols + randomBelow(random, 7) - 3, 0), fuzzMap.rows - 1);
+                int col = std::min(std::max(centre % fuzzMap.cols + randomBelow(random, 7) - 3, 0), fuzzMap.cols - 1);
+                sets[s].push_back(row * fuzzMap.cols + col);
+                setBlocks[s].push_back(std::make_pair(row, col));
+            }
+        }
+        long expected = referenceCost(fuzzMap, sets[0], sets[1]);
+        queries++;
+        for(int type = 0; type < AlgorithmFactory::ALGORITHM_COUNT; type++) {
+            for(LogicServer* server: servers) {
+                server->setAlgorithm(type, &board);
+                const std::pair<std::vector<std::pair<int, int>>, std::vector<std::pair<int, int>>>& result = server->findRoute(setBlocks[0], setBlocks[1]);
+                if(server == &logicServer) {
+                    expansions[type] += logicServer.getLastStats().expansions;
+                }
+                std::string error = checkRoute(fuzzMap, result.second, sets[0], sets[1], expected);
+                if(error.empty()) {
+                    error = checkVisited(fuzzMap, result.first);
+                }
+                if(!error.empty()) {
+                    failures++;
+                    std::fprintf(stderr, "case %d sets of %zu and %zu %s%s: %s\n", n, sets[0].size(), sets[1].size(),
+                                 AlgorithmFactory::getAlgorithmName(type).c_str(), server == &cachedServer ? " cached" : "", error.c_str());
+                    if(failures <= MAX_DUMPS) {
+                        dumpMap(fuzzMap);
+                    }
+                }
+            }
+        }
+
+        // a few alternative routes between two open blocks, which do not depend on the algorithm
+        int from = open[randomBelow(random, open.size())];
+        int to = open[randomBelow(random, open.size())];
+        int alternatives = 1 + randomBelow(random, 4);
+        queries++;
+        map->setStartPoint(from / fuzzMap.cols, from % fuzzMap.cols);
+        map->setTargetPoint(to / fuzzMap.cols, to % fuzzMap.cols);
+        std::string error = checkAlternatives(fuzzMap, logicServer.findAlternatives(alternatives), from, to, alternatives,
+                                              open.size() <= MAX_LISTED_BLOCKS);
+        if(!error.empty()) {
+            failures++;
+            std::fprintf(stderr, "case %d alternatives %d: (%d,%d) to (%d,%d): %s\n", n, alternatives, from / fuzzMap.cols, from % fuzzMap.cols,
+                         to / fuzzMap.cols, to % fuzzMap.cols, error.c_str());
+            if(failures <= MAX_DUMPS) {
+                dumpMap(fuzzMap);
+            }
+        }
+
+        // the first queries again under two versions of an overlay that closes blocks and changes weights, which
+        // the route cache must not answer with the routes of the map without it
+        for(int version = 0; version < 2; version++) {
+            FuzzMap overlaid = fuzzMap;
+            std::vector<OverlayChange> changes;
+            for(int i = 0; i < 4; i++) {
+                int cell = open[randomBelow(random, open.size())];
+                int weight = randomBelow(random, 2) == 0 ? GraphView::CLOSED : 1 + randomBelow(random, 9);
+                changes.push_back({cell / fuzzMap.cols, cell % fuzzMap.cols, weight});
+                overlaid.weights[cell] = weight;
+            }
+            OverlayStore::getInstance().publish(board.getMapType(), changes);
+            for(int q = 0; q < (int) pairs.size(); q++) {
+                int start = pairs[q].first;
+                int target = pairs[q].second;
+                if(fuzzMap.walls[start] || fuzzMap.walls[target]) {
+                    continue;
+                }
+                long expected = referenceCost(overlaid, {start}, {target});
+                queries++;
+                for(int type = 0; type < AlgorithmFactory::ALGORITHM_COUNT; type++) {
+                    for(LogicServer* server: servers) {
+                        server->setAlgorithm(type, &board);
+                        map->setStartPoint(start / fuzzMap.cols, start % fuzzMap.cols);
+                        map->setTargetPoint(target / fuzzMap.cols, target % fuzzMap.cols);
+                        const std::pair<std::vector<std::pair<int, int>>, std::vector<std::pair<int, int>>>& result = server->runAlgorithm();
+                        if(server == &logicServer) {
+                            expansions[type] += logicServer.getLastStats().expansions;
+                        }
+                        std::string error = checkRoute(overlaid, result.second, {start}, {target}, expected);
+                        if(error.empty()) {
+                            error = checkVisited(overlaid, result.first);
+                        }
+                        if(!error.empty()) {
+                            failures++;
+                            std::fprintf(stderr, "case %d overlay %d query %d %s%s: (%d,%d) to (%d,%d): %s\n", n, version, q,
+                                         AlgorithmFactory::getAlgorithmName(type).c_str(), server == &cachedServer ? " cached" : "",
+                                         start / fuzzMap.cols, start % fuzzMap.cols, target / fuzzMap.cols, target % fuzzMap.cols, error.c_str());
+                            if(failures <= MAX_DUMPS) {
+                                dumpMap(overlaid);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        OverlayStore::getInstance().publish(board.getMapType(), {});
+    }
+
+    std::printf("%d cases, %ld queries, %ld failures (seed %u)\n", cases, queries, failures, seed);
+    std::map<std::string, long> baseline = readBaseline(baselinePath);
+    bool regressed = false;
+    for(int type = 0; type < AlgorithmFactory::ALGORITHM_COUNT; type++) {
+        std::string name = AlgorithmFactory::getAlgorithmName(type);
+        std::printf("%-10s %12ld expansions", name.c_str(), expansions[type]);
+        auto known = baseline.find(name);
+        if(updateBaseline || known == baseline.end()) {
+            std::printf("\n");
+        } else {
+            double change = known->second > 0 ? (expansions[type] - known->second) * 100.0 / known->second : 0;
+            std::printf("  %+.1f%% against the baseline\n", change);
+            if(change > tolerance) {
+                std::fprintf(stderr, "%s expands %.1f%% more blocks than the baseline allows\n", name.c_str(), change);
+                regressed = true;
+            }
+        }
+    }
+
+    if(updateBaseline) {
+        if(failures > 0) {
+            std::fprintf(stderr, "not writing a baseline from a failing run\n");
+            return 1;
+        }
+        std::ofstream out(baselinePath);
+        for(int type = 0; type < AlgorithmFactory::ALGORITHM_COUNT; type++) {
+            out << AlgorithmFactory::getAlgorithmName(type) << " " << expansions[type] << "\n";
+        }
+        std::printf("wrote %s\n", baselinePath.c_str());
+    } else if(baseline.empty()) {
+        std::printf("no baseline in %s, run with --update-baseline to record one\n", baselinePath.c_str());
+    }
+    return failures > 0 || regressed ? 1 : 0;
+}
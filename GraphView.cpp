@@ -0,0 +1,107 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: Compact graph of the walkable blocks of a map, the structure every search runs on.
+*/
+
+#include "GraphView.h"
+#include <cstddef>
+#include "MapSnapshot.h"
+
+/**
+* Builds the graph of a map, sized exactly to its walkable blocks.
+* @param rows: the number of rows of the map.
+* @param cols: the number of columns of the map.
+* @param blocks: the blocks of the map row by row.
+*/
+void GraphView::build(int rows, int cols, const std::vector<Block>& blocks) {
+    this->rows = rows;
+    this->cols = cols;
+    int count = rows * cols;
+    std::vector<unsigned long long>& bits = walkable.owned();
+    bits.assign((count + 63) / 64, 0);
+    for(int cell = 0; cell < count; cell++) {
+        if(blocks[cell].getType() != 5) {
+            bits[cell >> 6] |= 1ULL << (cell & 63);
+        }
+    }
+    std::vector<int>& ranks = rankBefore.owned();
+    ranks.resize(bits.size());
+    int nodes = 0;
+    for(std::size_t word = 0; word < bits.size(); word++) {
+        ranks[word] = nodes;
+        nodes += __builtin_popcountll(bits[word]);
+    }
+
+    std::vector<int>& nodeCells = cells.owned();
+    nodeCells.resize(nodes);
+    weights.resize(nodes);
+    int node = 0;
+    for(int cell = 0; cell < count; cell++) {
+        if(blocks[cell].getType() != 5) {
+            nodeCells[node] = cell;
+            weights[node] = blocks[cell].getWeight();
+            node++;
+        }
+    }
+    walkable.useOwned();
+    rankBefore.useOwned();
+    cells.useOwned();
+}
+
+/**
+* Writes the tables that depend only on the walls to a snapshot.
+* @param out: the snapshot being written.
+*/
+void GraphView::saveTables(SnapshotWriter& out) const {
+    out.append(walkable.begin(), walkable.size());
+    out.append(rankBefore.begin(), rankBefore.size());
+    out.append(cells.begin(), cells.size());
+}
+
+/**
+* Uses the tables of a snapshot written by saveTables for a map with the same walls, and takes the weights
+* from the blocks.
+* @param in: the snapshot, at the tables of the map.
+* @param rows: the number of rows of the map.
+* @param cols: the number of columns of the map.
+* @param blocks: the blocks of the map row by row.
+* @return true if the tables were read and fit the map, false if the graph must be built.
+*/
+bool GraphView::mapTables(SnapshotReader& in, int rows, int cols, const std::vector<Block>& blocks) {
+    const unsigned long long* bits;
+    const int* ranks;
+    const int* nodeCells;
+    std::size_t words, rankCount, nodes;
+    if(!in.next(bits, words) || !in.next(ranks, rankCount) || !in.next(nodeCells, nodes)
+       || words != ((std::size_t) rows * cols + 63) / 64 || rankCount != words) {
+        return false;
+    }
+    this->rows = rows;
+    this->cols = cols;
+    walkable.useMapped(bits, words);
+    rankBefore.useMapped(ranks, rankCount);
+    cells.useMapped(nodeCells, nodes);
+    weights.resize(nodes);
+    for(std::size_t node = 0; node < nodes; node++) {
+        weights[node] = blocks[nodeCells[node]].getWeight();
+    }
+    return true;
+}
+
+/**
+* Changes the weight of a node after its block was edited.
+* @param node: the node.
+* @param weight: the new weight.
+*/
+void GraphView::setWeight(int node, int weight) {
+    weights[node] = weight;
+}
+
+/**
+* Bytes used by the graph, without the tables mapped from a snapshot, which are shared.
+* @return bytes: the memory of the bitmap and the nodes.
+*/
+long GraphView::getMemoryBytes() const {
+    return sizeof(GraphView) + walkable.getOwnedBytes() + rankBefore.getOwnedBytes() + cells.getOwnedBytes() + weights.capacity();
+}
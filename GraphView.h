@@ -0,0 +1,110 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: Compact graph of the walkable blocks of a map, the structure every search runs on.
+*/
+
+#ifndef GRAPHVIEW_H
+#define GRAPHVIEW_H
+
+#include <vector>
+#include "Block.h"
+#include "TableView.h"
+
+class SnapshotReader;
+class SnapshotWriter;
+
+/**
+* The walkable blocks of a map as nodes numbered 0 to getNodeCount() - 1, row by row. Walls take no
+* space besides one bit of the walkable bitmap, which also maps a block to its node: the node of a
+* walkable block is the number of walkable blocks before it, counted with one stored total per 64
+* blocks and a popcount. Edges are not stored, the neighbours of a node are found in the bitmap.
+* The bitmap, the totals and the blocks of the nodes depend only on the walls and may be mapped from
+* a MapSnapshot instead of built; the weights are always the map's own.
+*/
+class GraphView {
+    public:
+        // the weight of a block closed by a WeightOverlay: it is still a node but cannot be entered
+        static const int CLOSED = 0;
+
+        void build(int rows, int cols, const std::vector<Block>& blocks);
+        void saveTables(SnapshotWriter& out) const;
+        bool mapTables(SnapshotReader& in, int rows, int cols, const std::vector<Block>& blocks);
+        void setWeight(int node, int weight);
+        long getMemoryBytes() const;
+
+        int getNodeCount() const {
+            return cells.size();
+        }
+        int getColumns() const {
+            return cols;
+        }
+        /**
+        * Finds the node of a block.
+        * @param row: the row of the block.
+        * @param col: the column of the block.
+        * @return node: the node of the block, -1 if it is a wall or off the map.
+        */
+        int getNode(int row, int col) const {
+            if(row < 0 || col < 0 || row >= rows || col >= cols) {
+                return -1;
+            }
+            return nodeOfCell(row * cols + col);
+        }
+        // the block of a node as row * columns + column
+        int getCell(int node) const {
+            return cells[node];
+        }
+        int getRow(int node) const {
+            return cells[node] / cols;
+        }
+        int getColumn(int node) const {
+            return cells[node] % cols;
+        }
+        // the cost of entering the node, CLOSED if it cannot be entered
+        int getWeight(int node) const {
+            return weights[node];
+        }
+        /**
+        * Finds the walkable neighbours of a node above, below, left and right of it, in that order.
+        * @param node: the node.
+        * @param neighbours: filled with the nodes of the neighbours.
+        * @return count: the number of neighbours.
+        */
+        int getNeighbours(int node, int neighbours[4]) const {
+            int count = 0;
+            int cell = cells[node];
+            int col = cell % cols;
+            const int candidates[] = {cell >= cols ? cell - cols : -1, cell + cols < rows * cols ? cell + cols : -1,
+                                      col > 0 ? cell - 1 : -1, col + 1 < cols ? cell + 1 : -1};
+            for(int candidate: candidates) {
+                if(candidate >= 0) {
+                    int neighbour = nodeOfCell(candidate);
+                    if(neighbour >= 0) {
+                        neighbours[count++] = neighbour;
+                    }
+                }
+            }
+            return count;
+        }
+    private:
+        int rows = 0;
+        int cols = 0;
+        // one bit per block, set for walkable blocks
+        TableView<unsigned long long> walkable;
+        // walkable blocks before each 64 block word of the bitmap
+        TableView<int> rankBefore;
+        TableView<int> cells;
+        std::vector<unsigned char> weights;
+
+        int nodeOfCell(int cell) const {
+            unsigned long long word = walkable[cell >> 6];
+            unsigned long long bit = 1ULL << (cell & 63);
+            if(!(word & bit)) {
+                return -1;
+            }
+            return rankBefore[cell >> 6] + __builtin_popcountll(word & (bit - 1));
+        }
+};
+
+#endif
@@ -4,6 +4,7 @@
  * Date: November 28, 2023
 */
 
+#include <Wt/WAnchor.h>
 #include <Wt/WApplication.h>
 #include <Wt/WBreak.h>
 #include <Wt/WContainerWidget.h>
@@ -14,8 +15,12 @@
 #include <Wt/WMenuItem.h>
 #include <Wt/WImage.h>
 #include <Wt/WLink.h>
+#include <Wt/WTableCell.h>
+#include <functional>
 #include <vector>
 #include "Interface.h"
+#include "SearchMetrics.h"
+#include "TraceEncoder.h"
 
 /**
  * @brief This constructor initializes the application's display screen.
@@ -24,7 +29,7 @@
 Interface::Interface(const Wt::WEnvironment& env)
  : WApplication(env)
 {
-  buildingDictionaryInstance_ = new BuildingDictionary();
+  buildingDictionaryInstance_ = &BuildingDictionary::getInstance();
   boardInstance_ = new Board();
   logicServerInstance_= new LogicServer(boardInstance_);
   draggable_= 1;
@@ -35,30 +40,98 @@ Interface::Interface(const Wt::WEnvironment& env)
   setSelectedText();
   setSelectorType();
   setMap();
+  memoryAccount_ = MemoryLedger::getInstance().openSession();
+  SearchMetrics::sessionStarted();
+  updateMemory();
+  // ?trace=1 records the phases of every request of this session, downloadable as a Chrome trace
+  const std::string* trace = env.getParameter("trace");
+  if(trace && *trace == "1") {
+    traceRecorder_ = std::make_shared<TraceRecorder>();
+    traceResource_ = std::make_shared<PhaseTraceResource>(traceRecorder_);
+    root()->addWidget(std::make_unique<Wt::WAnchor>(Wt::WLink(traceResource_), "Download Trace"));
+  }
+}
+
+/**
+ * @brief This destructor releases the board and the algorithm of the session.
+*/
+Interface::~Interface()
+{
+  SearchMetrics::sessionEnded(sessionMemory_.getMapBytes(), sessionMemory_.getTotal() - sessionMemory_.getMapBytes());
+  MemoryLedger::getInstance().closeSession(memoryAccount_);
+  delete logicServerInstance_;
+  delete boardInstance_;
+}
+
+/**
+ * @brief This function handles every event of the session, see handleEvent.
+ * @param event, the event to handle.
+*/
+void Interface::notify(const Wt::WEvent& event)
+{
+  handleEvent([this, &event]() { Wt::WApplication::notify(event); });
+}
+
+/**
+ * @brief This function runs the handlers of an event inside a request span and then measures the memory of the session.
+ * The span covers the event handlers and, for an event from the browser, the rendering of the response by Wt, and
+ * installs the trace recorder of the session, if it is traced, for the spans opened while handling the event.
+ * The load harness fires the signals of the widgets through it, so its events are traced and measured the same way.
+ * @param handlers, runs the handlers of the event.
+*/
+void Interface::handleEvent(const std::function<void()>& handlers)
+{
+  TraceSpan span(PHASE_REQUEST, boardInstance_->getMapType(), traceRecorder_.get());
+  handlers();
+  // the graphs of a map are built by its first search, and a custom map may be loaded at any time
+  updateMemory();
+}
+
+/**
+ * @brief This function measures the memory of the session by structure and reports what changed to the
+ * metrics and the memory ledger, with a warning in the log when the session goes over the budget.
+ * The maps are measured; the widgets of the classic board are estimated from their sizes, without what
+ * Wt allocates inside them.
+*/
+void Interface::updateMemory()
+{
+  SessionMemory memory;
+  memory.bytes[SessionMemory::CLASSIC_MAP] = boardInstance_->getMapMemoryBytes(0);
+  memory.bytes[SessionMemory::CAMPUS_MAP] = boardInstance_->getMapMemoryBytes(1);
+  memory.bytes[SessionMemory::CUSTOM_MAP] = boardInstance_->getMapMemoryBytes(2);
+  memory.bytes[SessionMemory::BOARD] = boardInstance_->getMemoryBytes() - memory.bytes[SessionMemory::CLASSIC_MAP]
+    - memory.bytes[SessionMemory::CAMPUS_MAP] - memory.bytes[SessionMemory::CUSTOM_MAP];
+  long cells = (long) mapContainer_->rowCount() * mapContainer_->columnCount();
+  memory.bytes[SessionMemory::TABLE_CELLS] = cells * (sizeof(Wt::WTableCell) + sizeof(CustomDropContainerWidget));
+  memory.bytes[SessionMemory::CLICK_HANDLERS] = cells * dragHandlerBytes_;
+  memory.bytes[SessionMemory::CAMPUS_WIDGET] = sizeof(CampusMapWidget);
+  if(memory == sessionMemory_) {
+    return;
+  }
+  SearchMetrics::sessionResized(memory.getMapBytes() - sessionMemory_.getMapBytes(),
+                                memory.getTotal() - memory.getMapBytes() - sessionMemory_.getTotal() + sessionMemory_.getMapBytes());
+  sessionMemory_ = memory;
+  MemoryLedger& ledger = MemoryLedger::getInstance();
+  if(ledger.updateSession(memoryAccount_, memory)) {
+    log("warning") << "session " << memoryAccount_ << " holds " << memory.getTotal() << " bytes, over the budget of "
+                   << ledger.getBudget() << " bytes, see /admin/memory";
+  }
 }
 
 /**
-* @brief This function implements the visualization of the algorithm as it searches for the shortest path by colouring the cell.
+ * @brief This function sends the result of a search to the browser, which animates it.
+ * The visited nodes and the shortest path travel as two delta-encoded arrays in one update,
+ * so the server does not touch a widget per visited cell.
  * @param visitedNodes, a vector containing all the nodes visited when trying to find the shortest path.
- * @return delay, the number of visited nodes, and the paint delay for each node.
+ * @param shortestPath, a vector containing the shortest path from the start to destination nodes.
 */
-int Interface::paintVisitedNode(std::vector<std::pair<int, int>> visitedNodes) {
-  int type = boardInstance_->getMapType();
-  int delay = 1;
-  for(std::pair<int, int> node: visitedNodes) {
-    if(type == 0) {
-      std::string delayText = "animation-delay:" + std::to_string(delay * 0.01) + "s";
-      mapContainer_->elementAt(node.first, node.second)->setAttributeValue("style", delayText);
-      mapContainer_->elementAt(node.first, node.second)->setStyleClass("visited board-cell");
-    } else {
-      std::string delayText = "animation-delay:" + std::to_string(delay * 0.005) + "s";
-      campusMapContainer_->elementAt(node.first, node.second)->setAttributeValue("style", delayText);
-      campusMapContainer_->elementAt(node.first, node.second)->setStyleClass("campus-visited campus-board-cell");
-    }
-    
-    delay++;
+void Interface::animateSearch(const std::vector<std::pair<int, int>>& visitedNodes, const std::vector<std::pair<int, int>>& shortestPath) {
+  TraceSpan span(PHASE_PAINT, boardInstance_->getMapType());
+  if(boardInstance_->getMapType() == 0) {
+    mapContainer_->doJavaScript(mapContainer_->jsRef() + ".naviAnimate(" + TraceEncoder::encode(visitedNodes, 52) + "," + TraceEncoder::encode(shortestPath, 52) + ");");
+  } else {
+    campusMapContainer_->animateTrace(visitedNodes, shortestPath);
   }
-  return delay;
 }
 
 /**
@@ -105,23 +178,12 @@ void Interface::setHeader()
   auto boardSelector = boardSelectorPtr.get();
   boardSelector->addStyleClass("drop-down__menu");
 
-  Wt::WMenuItem *boardOne = boardSelector->addItem("Classic Board");
-  boardOne->addStyleClass("drop-down__item");
-  boardOne->triggered().connect([=] {
+  classicBoardItem_ = boardSelector->addItem("Classic Board");
+  classicBoardItem_->addStyleClass("drop-down__item");
+  classicBoardItem_->triggered().connect([=] {
       int boardType = boardInstance_->getMapType();
       if(boardType != 0) {
-        int logicType = logicServerInstance_->getAlgorithmType();
-        delete boardInstance_;
-        delete logicServerInstance_;
-        boardInstance_ = new Board(1);
-        logicServerInstance_= new LogicServer(boardInstance_);
-        logicServerInstance_->setAlgorithm(logicType, boardInstance_);
-        errorMessage_->hide();
-        paintCampusMap();
-        selectedCampusStartPoint_->setText("Start Building: None");
-        selectedCampusTargetPoint_->setText("Target Building: None");
-        setStart = true;
-        changeSelectorButton_->setText("Set Target Building");
+        resetCampusBoard();
         
         // switch map to classic map
         boardInstance_->switchMap(0);
@@ -137,17 +199,13 @@ void Interface::setHeader()
   boardSelector->addSeparator();
 
   //Initializes the campus map
-  Wt::WMenuItem *boardTwo = boardSelector->addItem("Campus Map");
-  boardTwo->addStyleClass("drop-down__item");
-  boardTwo->triggered().connect([=] {
-    int logicType = logicServerInstance_->getAlgorithmType();
-    delete boardInstance_;
-    delete logicServerInstance_;
-    boardInstance_ = new Board();
-    logicServerInstance_= new LogicServer(boardInstance_);
-    logicServerInstance_->setAlgorithm(logicType, boardInstance_);
-    paintClassicMap();
-    setInitialStartAndTargetNode();
+  campusBoardItem_ = boardSelector->addItem("Campus Map");
+  campusBoardItem_->addStyleClass("drop-down__item");
+  campusBoardItem_->triggered().connect([=] {
+    if(boardInstance_->getMapType() == 1) {
+      return;
+    }
+    resetClassicBoard();
     boardInstance_->switchMap(1);
     mapContainer_->hide();
     campusMapContainer_->show();
@@ -163,102 +221,146 @@ void Interface::setHeader()
   boardButton->setMenu(move(boardSelectorPtr));
 
   //Visualizes path
-  auto visualizeButton_ = headerContainer->addWidget(std::make_unique<Wt::WPushButton>("Visualize!"));
+  visualizeButton_ = headerContainer->addWidget(std::make_unique<Wt::WPushButton>("Visualize!"));
   visualizeButton_->clicked().connect([=] {
     int type = boardInstance_->getMapType();
+    TraceSpan span(PHASE_VISUALIZE, type);
     if(type == 0) {
       draggable_ = 0;
-      int startPointRow = boardInstance_->getMap()->getStartPoint()->getRow();
-      int startPointCol = boardInstance_->getMap()->getStartPoint()->getColumn();
-      int targetPointRow = boardInstance_->getMap()->getTargetPoint()->getRow();
-      int targetPointCol = boardInstance_->getMap()->getTargetPoint()->getColumn();
-      WImage* startContainer = (WImage*) (mapContainer_->elementAt(startPointRow, startPointCol)->children()[0]->children()[0]);
-      startContainer->unsetDraggable();
-      WImage* targetContainer = (WImage*) (mapContainer_->elementAt(targetPointRow, targetPointCol)->children()[0]->children()[0]);
-      targetContainer->unsetDraggable();
-      std::pair<std::vector<std::pair<int, int>>, std::vector<std::pair<int, int>>> result = logicServerInstance_->runAlgorithm();
-      int delay = paintVisitedNode(result.first);
-      paintShortestPathNode(result.second, delay);
+      setIndicatorsDraggable(false);
+      const std::pair<std::vector<std::pair<int, int>>, std::vector<std::pair<int, int>>>& result = logicServerInstance_->runAlgorithm();
+      animateSearch(result.first, result.second);
     } else {
       if(selectedCampusStartPoint_->text() == "Start Building: None" || selectedCampusTargetPoint_->text() == "Target Building: None") {
         errorMessage_->show();
         return;
       }
-      int startPointRow = boardInstance_->getMap()->getStartPoint()->getRow();
-      int startPointCol = boardInstance_->getMap()->getStartPoint()->getColumn();
-      int targetPointRow = boardInstance_->getMap()->getTargetPoint()->getRow();
-      int targetPointCol = boardInstance_->getMap()->getTargetPoint()->getColumn();
-
-      std::pair<std::vector<std::pair<int, int>>, std::vector<std::pair<int, int>>> result = logicServerInstance_->runAlgorithm();
-
-      int delay = paintVisitedNode(result.first);
-      paintShortestPathNode(result.second, delay);
+      // one search from every door of the start building to the nearest door of the target building
+      const LevelMap& campusMap = *boardInstance_->getMap();
+      std::vector<std::pair<int, int>> startCells;
+      std::vector<std::pair<int, int>> targetCells;
+      buildingDictionaryInstance_->appendBuildingCells(startBuildingId, buildingScope, campusMap, startCells);
+      buildingDictionaryInstance_->appendBuildingCells(targetBuildingId, buildingScope, campusMap, targetCells);
+      const std::pair<std::vector<std::pair<int, int>>, std::vector<std::pair<int, int>>>& result = logicServerInstance_->findRoute(startCells, targetCells);
+
+      animateSearch(result.first, result.second);
     }
   });
 
   //Clears board
-  auto clearBoardButton_ = headerContainer->addWidget(std::make_unique<Wt::WPushButton>("Clear Board"));
+  clearBoardButton_ = headerContainer->addWidget(std::make_unique<Wt::WPushButton>("Clear Board"));
   clearBoardButton_->clicked().connect([=] {
-    int mapType = boardInstance_->getMapType();
-    int type = logicServerInstance_->getAlgorithmType();
-    delete boardInstance_;
-    delete logicServerInstance_;
-    if(mapType == 0) {
-      boardInstance_ = new Board();
-      logicServerInstance_= new LogicServer(boardInstance_);
-      logicServerInstance_->setAlgorithm(type, boardInstance_);
-      paintClassicMap();
-      setInitialStartAndTargetNode();
+    if(boardInstance_->getMapType() == 0) {
+      resetClassicBoard();
     } else {
-      boardInstance_ = new Board(1);
-      logicServerInstance_= new LogicServer(boardInstance_);
-      logicServerInstance_->setAlgorithm(type, boardInstance_);
-      paintCampusMap();
-      selectedCampusStartPoint_->setText("Start Building: None");
-      selectedCampusTargetPoint_->setText("Target Building: None");
-      setStart = true;
-      changeSelectorButton_->setText("Set Target Building");
-      errorMessage_->hide();
+      resetCampusBoard();
     }
   });
 
   //Clears walls
   clearWallButton_ = headerContainer->addWidget(std::make_unique<Wt::WPushButton>("Clear Walls & Weight"));
   clearWallButton_->clicked().connect([=] {
-    int startRow = boardInstance_->getMap()->getStartPoint()->getRow();
-    int startCol = boardInstance_->getMap()->getStartPoint()->getColumn();
-    int targetRow = boardInstance_->getMap()->getTargetPoint()->getRow();
-    int targetCol = boardInstance_->getMap()->getTargetPoint()->getColumn();
-    int type = logicServerInstance_->getAlgorithmType();
-    delete boardInstance_;
-    delete logicServerInstance_;
-    boardInstance_ = new Board();
-    logicServerInstance_= new LogicServer(boardInstance_);
-    logicServerInstance_->setAlgorithm(type, boardInstance_);
-    paintClassicMap();
-    setStartAndTargetNode(startRow, startCol, targetRow, targetCol, boardInstance_);
+    clearClassicWalls();
+    clearClassicPath();
   });
 
   //Clears path visualizations
   clearPathButton_ = headerContainer->addWidget(std::make_unique<Wt::WPushButton>("Clear Path"));
   clearPathButton_->clicked().connect([=] {
-    std::vector<std::pair<int, int>> walls = boardInstance_->getMap()->getWallsInfo();
-    int startRow = boardInstance_->getMap()->getStartPoint()->getRow();
-    int startCol = boardInstance_->getMap()->getStartPoint()->getColumn();
-    int targetRow = boardInstance_->getMap()->getTargetPoint()->getRow();
-    int targetCol = boardInstance_->getMap()->getTargetPoint()->getColumn();
-    int type = logicServerInstance_->getAlgorithmType();
-    delete boardInstance_;
-    delete logicServerInstance_;
-    boardInstance_ = new Board();
-    logicServerInstance_= new LogicServer(boardInstance_);
-    logicServerInstance_->setAlgorithm(type, boardInstance_);
-    paintClassicMap();
-    setStartAndTargetNode(startRow, startCol, targetRow, targetCol, boardInstance_);
-    paintWalls(walls, boardInstance_);
+    clearClassicPath();
   });
 }
 
+/**
+ * @brief This method takes the classic board back to its initial state: no walls, no path,
+ * and the start and target nodes at their initial position. Only the cells that changed are touched.
+*/
+void Interface::resetClassicBoard() {
+  clearClassicWalls();
+  clearClassicPath();
+  LevelMap* classicMap = boardInstance_->getMap();
+  int startRow = classicMap->getStartPoint().first;
+  int startCol = classicMap->getStartPoint().second;
+  int targetRow = classicMap->getTargetPoint().first;
+  int targetCol = classicMap->getTargetPoint().second;
+  if(startRow != 10 || startCol != 12 || targetRow != 10 || targetCol != 40) {
+    auto startCell = (CustomDropContainerWidget *) mapContainer_->elementAt(startRow, startCol)->children()[0];
+    startCell->removeWidget(indicatorAt(startRow, startCol, "Start-Icon"));
+    auto targetCell = (CustomDropContainerWidget *) mapContainer_->elementAt(targetRow, targetCol)->children()[0];
+    targetCell->removeWidget(indicatorAt(targetRow, targetCol, "End-Icon"));
+    setStartAndTargetNode(10, 12, 10, 40, boardInstance_);
+  }
+}
+
+/**
+ * @brief This method removes the path visualization from the classic board and lets the
+ * start and target nodes be dragged again. The walls are kept.
+*/
+void Interface::clearClassicPath() {
+  draggable_ = 1;
+  mapContainer_->doJavaScript(mapContainer_->jsRef() + ".naviClear();");
+  setIndicatorsDraggable(true);
+}
+
+/**
+ * @brief This method removes the walls from the classic board, repainting only the cells that were walls.
+*/
+void Interface::clearClassicWalls() {
+  for(std::pair<int, int> wall: boardInstance_->getMap()->clearWalls()) {
+    mapContainer_->elementAt(wall.first, wall.second)->children()[0]->removeStyleClass("wall");
+    mapContainer_->elementAt(wall.first, wall.second)->setStyleClass("unvisited board-cell");
+  }
+}
+
+/**
+ * @brief This method takes the campus board back to its initial state: no building selected and no path.
+*/
+void Interface::resetCampusBoard() {
+  paintCampusMap();
+  selectedCampusStartPoint_->setText("Start Building: None");
+  selectedCampusTargetPoint_->setText("Target Building: None");
+  setStart = true;
+  changeSelectorButton_->setText("Set Target Building");
+  errorMessage_->hide();
+}
+
+/**
+ * @brief This method finds the start or target icon on a cell of the classic board.
+ * @param row, the row of the cell.
+ * @param col, the column of the cell.
+ * @param alternateText, "Start-Icon" or "End-Icon".
+ * @return icon, the icon or nullptr if the cell does not hold it.
+*/
+Wt::WImage* Interface::indicatorAt(int row, int col, const std::string& alternateText) {
+  for(Wt::WWidget* child: mapContainer_->elementAt(row, col)->children()[0]->children()) {
+    Wt::WImage* icon = dynamic_cast<Wt::WImage*>(child);
+    if(icon && icon->alternateText().toUTF8() == alternateText) {
+      return icon;
+    }
+  }
+  return nullptr;
+}
+
+/**
+ * @brief This method enables or disables dragging of the start and target icons.
+ * @param draggable, true to allow dragging.
+*/
+void Interface::setIndicatorsDraggable(bool draggable) {
+  LevelMap* classicMap = boardInstance_->getMap();
+  Wt::WImage* startIcon = indicatorAt(classicMap->getStartPoint().first, classicMap->getStartPoint().second, "Start-Icon");
+  Wt::WImage* targetIcon = indicatorAt(classicMap->getTargetPoint().first, classicMap->getTargetPoint().second, "End-Icon");
+  for(Wt::WImage* icon: {startIcon, targetIcon}) {
+    if(!icon) {
+      continue;
+    }
+    if(draggable) {
+      icon->setDraggable("WImage");
+    } else {
+      icon->unsetDraggable();
+    }
+  }
+}
+
 /**
  * @brief This method sets the start node and target node icons (target and arrow)
 */
@@ -326,6 +428,19 @@ void Interface::setSelectorType() {
     }
   });
 
+  //Routes between every door of the buildings, or every side of them
+  changeScopeButton_ = typeSelectorContainer_->addWidget(std::make_unique<Wt::WPushButton>("Use Whole Buildings"));
+  changeScopeButton_->addStyleClass("toggleSelectorButton");
+  changeScopeButton_->clicked().connect([=] {
+    if(buildingScope == BuildingDictionary::ENTRANCES) {
+      buildingScope = BuildingDictionary::FOOTPRINT;
+      changeScopeButton_->setText("Use Doors Only");
+    } else {
+      buildingScope = BuildingDictionary::ENTRANCES;
+      changeScopeButton_->setText("Use Whole Buildings");
+    }
+  });
+
   //Error message if not both a start and target building are selected
   errorMessage_ = typeSelectorContainer_->addWidget(std::make_unique<Wt::WText>("Please select both Start Building and Target Building!"));
   errorMessage_->addStyleClass("errorMessage");
@@ -342,28 +457,45 @@ void Interface::setMap() {
   boardContainer->setStyleClass("map-container");
   mapContainer_ = boardContainer->addWidget(std::make_unique<Wt::WTable>());
   mapContainer_->setStyleClass("table-background");
+  // client side animation of a trace, the same classes and delays the cells used to get one by one
+  mapContainer_->setJavaScriptMember("naviAnimate", "function(visited, path) {"
+    "this.naviClear();"
+    "var table = this, trace = table.naviTrace = [], c = 0, i, cell;"
+    "function at(index) { return table.rows[(index / 52) | 0].cells[index % 52]; }"
+    "for (i = 0; i < visited.length; i++) {"
+      "c += visited[i]; cell = at(c);"
+      "cell.style.animationDelay = ((i + 1) * 0.01) + 's';"
+      "cell.className = 'visited board-cell';"
+      "trace.push(cell);"
+    "}"
+    "for (i = 0, c = 0; i < path.length; i++) {"
+      "c += path[i]; cell = at(c);"
+      "cell.firstElementChild.style.transitionDelay = ((visited.length + 1 + i) * 0.01) + 's';"
+      "cell.className += ' shortest-path';"
+      "trace.push(cell);"
+    "}"
+    "}");
+  mapContainer_->setJavaScriptMember("naviClear", "function() {"
+    "var trace = this.naviTrace || [], i, cell;"
+    "for (i = 0; i < trace.length; i++) {"
+      "cell = trace[i];"
+      "cell.style.animationDelay = '';"
+      "cell.firstElementChild.style.transitionDelay = '';"
+      "cell.className = 'unvisited board-cell';"
+    "}"
+    "this.naviTrace = [];"
+    "}");
   paintClassicMap();
   setInitialStartAndTargetNode();
 
-  campusMapContainer_= boardContainer->addWidget(std::make_unique<Wt::WTable>());
+  campusMapContainer_= boardContainer->addWidget(std::make_unique<CampusMapWidget>(buildingDictionaryInstance_));
+  campusMapContainer_->cellClicked().connect([=](int row, int col) {
+    selectBuildingAt(row, col);
+  });
   paintCampusMap();
   campusMapContainer_->hide();
 }
 
-/**
- * @brief This method colours in/highlights the buildings on the campus map.
- * @param walls, the vector of the building coordinates.
- * @param board, an instance of the board class.
-*/
-void Interface::paintWalls(std::vector<std::pair<int, int>> walls, Board* board) {
-  for(std::pair<int, int> wall: walls) {
-    board->changeBlockInMap(wall.first, wall.second, 5);  
-    mapContainer_->elementAt(wall.first, wall.second)->children()[0]->addStyleClass("wall");
-    mapContainer_->elementAt(wall.first, wall.second)->removeStyleClass("unvisited");
-    mapContainer_->elementAt(wall.first, wall.second)->addStyleClass("wall");
-  }
-}
-
 /**
 * @brief This method illustrates the wall functionality on the classic map.
 */
@@ -376,12 +508,12 @@ void Interface::paintClassicMap() {
       auto dropContainer = mapContainer_->elementAt(i, j)->addWidget(std::make_unique<CustomDropContainerWidget>(boardInstance_));
       dropContainer->setStyleClass("board-cell");
       mapContainer_->elementAt(i, j)->setStyleClass("unvisited board-cell");
-      mapContainer_->elementAt(i, j)->mouseDragged().connect([=] {
+      auto onDragged = [=] {
         if(draggable_) {
-          int startRow = boardInstance_->getMap()->getStartPoint()->getRow();
-          int startCol = boardInstance_->getMap()->getStartPoint()->getColumn();
-          int targetRow = boardInstance_->getMap()->getTargetPoint()->getRow();
-          int targetCol = boardInstance_->getMap()->getTargetPoint()->getColumn();
+          int startRow = boardInstance_->getMap()->getStartPoint().first;
+          int startCol = boardInstance_->getMap()->getStartPoint().second;
+          int targetRow = boardInstance_->getMap()->getTargetPoint().first;
+          int targetCol = boardInstance_->getMap()->getTargetPoint().second;
           bool isStart = startRow == i && startCol == j;
           bool isTarget = targetRow == i && targetCol == j;
           // update wall infomration to board class
@@ -392,74 +524,46 @@ void Interface::paintClassicMap() {
             mapContainer_->elementAt(i, j)->addStyleClass("wall");
           }
         }
-      });
+      };
+      mapContainer_->elementAt(i, j)->mouseDragged().connect(onDragged);
+      dragHandlerBytes_ = sizeof(onDragged) + sizeof(std::function<void()>);
     }
   }
 }
 
 /**
- * @brief This method displays the start and target building names and highlights them when clicked.
+ * @brief This method resets the campus board: no building selected and no path drawn.
 */
 void Interface::paintCampusMap() {
-  campusMapContainer_->clear();
-  campusMapContainer_->setStyleClass("campus-board");
-  for (int i = 0; i < 200; ++i) {
-    for(int j = 0; j < 168; ++j){
-      auto child = campusMapContainer_->elementAt(i, j)->addWidget(std::make_unique<Wt::WContainerWidget>());
-      child->setStyleClass("campus-board-cell");
-      campusMapContainer_->elementAt(i, j)->setStyleClass("campus-board-cell");
-    }
-  }
-  std::vector<BuildingInfo> buildings = buildingDictionaryInstance_->getBuildings();
-
-  for(BuildingInfo building: buildings) {
-    std::vector<std::pair<int, int>> coordinates = building.getCoordinates();
-    std::string name = building.getName();
-    std::pair<int, int> entrance = building.getEntrance();
-    for(std::pair<int, int> coordinate: coordinates) {
-      // add click method, set attribute buildingName
-      campusMapContainer_->elementAt(coordinate.first, coordinate.second)->setAttributeValue("buildingName", name);
-      campusMapContainer_->elementAt(coordinate.first, coordinate.second)->clicked().connect([=] {
-      errorMessage_->hide();
-      
-      if(setStart) {
-        if(startCoordinates.size() != 0) {
-            clearBuildingHighlight(startCoordinates);       
-        }
-        startCoordinates = coordinates;
-        std::string text = "Start Building: " + name;
-        selectedCampusStartPoint_->setText(text);
-        boardInstance_->getMap()->setStartPoint(entrance.first, entrance.second);
-      } else {
-        if(targetCoordinates.size() != 0) {
-            clearBuildingHighlight(targetCoordinates);       
-        }
-        targetCoordinates = coordinates;
-        std::string text = "Target Building: " + name;
-        selectedCampusTargetPoint_->setText(text);
-        boardInstance_->getMap()->setTargetPoint(entrance.first, entrance.second);
-      }
-        
-        for(std::pair<int, int> coordinate: coordinates) {
-          if(setStart){
-            campusMapContainer_->elementAt(coordinate.first, coordinate.second)->addStyleClass("start_color");
-          }else{
-            campusMapContainer_->elementAt(coordinate.first, coordinate.second)->addStyleClass("target_color");
-          }   
-        }
-      });
-    }
-  }
+  startBuildingId = -1;
+  targetBuildingId = -1;
+  campusMapContainer_->clearOverlays();
 }
 
 /**
- * @brief This method clears the highlight on the selected building.
- * @param coordinates, the coordinates of the building highlighted.
+ * @brief This method selects the building under the clicked cell as the start or target building.
+ * @param row, the row of the clicked cell.
+ * @param col, the column of the clicked cell.
 */
-void Interface::clearBuildingHighlight(std::vector<std::pair<int, int>> coordinates) {
-  for(std::pair<int, int> coordinate: coordinates) {
-    campusMapContainer_->elementAt(coordinate.first, coordinate.second)->removeStyleClass("start_color");
-    campusMapContainer_->elementAt(coordinate.first, coordinate.second)->removeStyleClass("target_color");
+void Interface::selectBuildingAt(int row, int col) {
+  int buildingId = buildingDictionaryInstance_->getBuildingAt(row, col);
+  if(buildingId == -1) {
+    return;
+  }
+  errorMessage_->hide();
+  const BuildingInfo& selected = buildingDictionaryInstance_->getBuilding(buildingId);
+  std::pair<int, int> entrance = selected.getEntrance();
+
+  if(setStart) {
+    startBuildingId = buildingId;
+    selectedCampusStartPoint_->setText("Start Building: " + selected.getName());
+    boardInstance_->getMap()->setStartPoint(entrance.first, entrance.second);
+    campusMapContainer_->setStartBuilding(buildingId);
+  } else {
+    targetBuildingId = buildingId;
+    selectedCampusTargetPoint_->setText("Target Building: " + selected.getName());
+    boardInstance_->getMap()->setTargetPoint(entrance.first, entrance.second);
+    campusMapContainer_->setTargetBuilding(buildingId);
   }
 }
 
@@ -515,12 +619,11 @@ std::string Interface::getSelectedText() {
 
 /**
  * @brief This method paints the cells based on the type of cell.
- * @param node, the cell to be painted.
+ * @param row, the row of the cell to be painted.
+ * @param col, the column of the cell to be painted.
  * @param type, the type of cell.
 */
-void Interface::paintCell(Block node, int type) {
- int row = node.getRow();
- int col = node.getColumn();
+void Interface::paintCell(int row, int col, int type) {
  if (type == 0){
    // type 0 means shortestPath
    mapContainer_->elementAt(row, col)->setStyleClass("shortest-path board-cell");
@@ -532,26 +635,3 @@ void Interface::paintCell(Block node, int type) {
    mapContainer_->elementAt(row, col)->setStyleClass("unvisited board-cell");
  }
 }
-
-/**
- * @brief Visualizes the shortest path on the application grid.
- * @param shortestPath, a vector containing the shortest path from the start to destination nodes.
- * @param delay, the delay time to colour the node.
-*/
-void Interface::paintShortestPathNode(std::vector<std::pair<int, int>> shortestPath, int delay) {
-  int type = boardInstance_->getMapType();
-  for(std::pair<int, int> node: shortestPath) {
-    if(type == 0) {
-      std::string delayText = "transition-delay:" + std::to_string(delay * 0.01) + "s";
-      auto children = mapContainer_->elementAt(node.first, node.second)->children();
-      children[0]->setAttributeValue("style", delayText);
-      mapContainer_->elementAt(node.first, node.second)->addStyleClass("shortest-path");
-    } else {
-      std::string delayText = "transition-delay:" + std::to_string(delay * 0.005) + "s";
-      auto children = campusMapContainer_->elementAt(node.first, node.second)->children();
-      children[0]->setAttributeValue("style", delayText);
-      campusMapContainer_->elementAt(node.first, node.second)->addStyleClass("shortest-path");
-    }
-    delay++;
-  }
-}
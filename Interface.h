@@ -10,17 +10,24 @@
 #include <Wt/WApplication.h>
 #include <Wt/WBreak.h>
 #include <Wt/WContainerWidget.h>
+#include <Wt/WImage.h>
 #include <Wt/WLineEdit.h>
+#include <Wt/WMenuItem.h>
 #include <Wt/WPushButton.h>
 #include <Wt/WText.h>
 #include <Wt/WTable.h>
+#include <functional>
 #include <string>
 #include <vector>
 #include "Algorithm.h"
 #include "CustomDropContainerWidget.h"
+#include "CampusMapWidget.h"
 #include "Block.h"
 #include "LogicServer.h"
+#include "MemoryLedger.h"
 #include "BuildingDictionary.h"
+#include "PhaseTracer.h"
+#include "PhaseTraceResource.h"
 
 typedef struct Coordinate
 {
@@ -32,20 +39,30 @@ class Interface : public Wt::WApplication
 {
 public:
     Interface(const Wt::WEnvironment& env);
-    void          paintCell(Block node, int type);
+    ~Interface();
+    void          notify(const Wt::WEvent& event) override;
+    void          paintCell(int row, int col, int type);
 
 private:
-    BuildingDictionary               *buildingDictionaryInstance_;
+    // the load harness drives the widgets of sessions the way a browser would, see LoadTest.cpp
+    friend class SessionScript;
+
+    const BuildingDictionary         *buildingDictionaryInstance_;
     LogicServer                      *logicServerInstance_;
     Wt::WText                        *selectedText_;
     Wt::WTable                       *mapContainer_;
-    Wt::WTable                       *campusMapContainer_;
+    CampusMapWidget                  *campusMapContainer_;
     Wt::WContainerWidget             *indicatorImageContainer_;
     Wt::WContainerWidget             *campusIndicatorImageContainer_;
     Wt::WContainerWidget             *typeSelectorContainer_;
     Wt::WPushButton                  *clearWallButton_;
     Wt::WPushButton                  *clearPathButton_;
     Wt::WPushButton                  *changeSelectorButton_;
+    Wt::WPushButton                  *changeScopeButton_;
+    Wt::WPushButton                  *visualizeButton_;
+    Wt::WPushButton                  *clearBoardButton_;
+    Wt::WMenuItem                    *classicBoardItem_;
+    Wt::WMenuItem                    *campusBoardItem_;
     Board                            *boardInstance_;
     int                              draggable_;
     //std::vector<std::pair<int, int>> paths;
@@ -53,23 +70,41 @@ private:
     Wt::WText                        *selectedCampusTargetPoint_;
     Wt::WText                        *errorMessage_;
     bool                             setStart=true;
-    std::vector<std::pair<int, int>> startCoordinates;
-    std::vector<std::pair<int, int>> targetCoordinates;
+    // index into the building dictionary, -1 when nothing is selected
+    int                              startBuildingId = -1;
+    int                              targetBuildingId = -1;
+    // the cells of the buildings a campus route may start and end on, see BuildingDictionary::appendBuildingCells
+    int                              buildingScope = BuildingDictionary::ENTRANCES;
+    // memory of the session by structure, as last reported to the metrics and the memory ledger
+    SessionMemory                    sessionMemory_;
+    int                              memoryAccount_ = 0;
+    // bytes of the closure and function object of the drag handler of one cell of the classic board
+    long                             dragHandlerBytes_ = 0;
+    // set when the session was opened with ?trace=1, shared with the resource serving it, which the
+    // download link keeps alive after the session is destroyed
+    std::shared_ptr<TraceRecorder>   traceRecorder_;
+    std::shared_ptr<PhaseTraceResource> traceResource_;
 
     void                             setHeader();
+    void                             handleEvent(const std::function<void()>& handlers);
+    void                             updateMemory();
     void                             setIndicatorImage();
     void                             setCampusIndicatorImage();
     void                             setSelectedText();
     void                             setSelectorType();
     void                             setMap();
-    void                             paintWalls(std::vector<std::pair<int, int>> walls, Board* board);
     void                             paintClassicMap();
     void                             paintCampusMap();
-    void                             clearBuildingHighlight(std::vector<std::pair<int, int>> coordinates);
+    void                             resetClassicBoard();
+    void                             clearClassicPath();
+    void                             clearClassicWalls();
+    void                             resetCampusBoard();
+    Wt::WImage*                      indicatorAt(int row, int col, const std::string& alternateText);
+    void                             setIndicatorsDraggable(bool draggable);
+    void                             selectBuildingAt(int row, int col);
     void                             setInitialStartAndTargetNode();
     void                             setStartAndTargetNode(int startRow, int startCol, int targetRow, int targetCol, Board* board);
     std::string                      getSelectedText();
-    void                             paintShortestPathNode(std::vector<std::pair<int, int>> shortestPath, int delay = 0);
-    int                              paintVisitedNode(std::vector<std::pair<int, int>> visitedNodes);
+    void                             animateSearch(const std::vector<std::pair<int, int>>& visitedNodes, const std::vector<std::pair<int, int>>& shortestPath);
 };
 #endif
@@ -4,30 +4,52 @@
 * Purpose: To act as a 2D map and contains every information about it.
 */
 #include "LevelMap.h"
+#include "MapSnapshot.h"
 
 /**
-* Set the map when we need to have custom map.
-* @param map: it is a matrix of Blocks which represent the 2D map information.
+* Constructor for an open rectangular map of any size, used for custom and synthetic maps.
+* Every block starts walkable, the start point is the top left corner and the target point the bottom right one.
+* @param rows: the number of rows of the map.
+* @param cols: the number of columns of the map.
 */
-void LevelMap::setMap(std::vector<std::vector<Block>> map)
+LevelMap::LevelMap(int rows, int cols)
 {
-   this->map = map;
+   this->rows = rows;
+   this->cols = cols;
+   blocks.assign(rows * cols, Block());
+   if(rows > 0 && cols > 0) {
+      setStartPoint(0, 0);
+      setTargetPoint(rows - 1, cols - 1);
+   }
 }
 
 /**
-* Return the map information.
-* @return map: it is a matrix of Blocks which represent the 2D map information.
+* Set the map when we need to have custom map.
+* @param map: it is a matrix of Blocks which represent the 2D map information, every row as long as the first.
 */
-std::vector<std::vector<Block>> LevelMap::getMap() {
-   return map;
+void LevelMap::setMap(std::vector<std::vector<Block>> map)
+{
+   rows = map.size();
+   cols = rows > 0 ? map[0].size() : 0;
+   blocks.clear();
+   blocks.reserve(rows * cols);
+   for(std::vector<Block>& rowData: map) {
+      blocks.insert(blocks.end(), rowData.begin(), rowData.end());
+   }
+   startPoint = -1;
+   targetPoint = -1;
+   overlay = nullptr;
+   versionKnown = false;
+   graphKnown = false;
+   chainsKnown = false;
 }
 
 /**
-* Return the selected positioned node pointer reference.
-* @return block: it is a block pointer related to a selected position.
+* Return the map information.
+* @return map: the Blocks of the 2D map row by row, the block at row, col is at row * columns + col.
 */
-Block* LevelMap::getNode(int row, int col) {
-   return &map[row][col];
+const std::vector<Block>& LevelMap::getMap() const {
+   return blocks;
 }
 
 /**
@@ -42,42 +64,26 @@ void LevelMap::setFloor(int level){
 * Return the floor level this map represent.
 * @return floor: it indicate which floor plan for the building this map is represent.
 */
-int LevelMap::getFloor(){
+int LevelMap::getFloor() const {
    return floor;
 }
 
 /**
 * add the entrance node to the floor plan map.
-* @param entrance: it indicate a pointer of which node is the entrance node in map.
+* @param row: the row of the entrance node in map.
+* @param col: the column of the entrance node in map.
 */
-void LevelMap::addEntrance(Block* entrance){
-   entrances.push_back(entrance);
+void LevelMap::addEntrance(int row, int col){
+   entrances.push_back(std::make_pair(row, col));
 }
 
 /**
 * add the exit node to the floor plan map.
-* @param exit: it indicate a pointer of which node is the exit node in map.
-*/
-void LevelMap::addExit(Block* exit){
-   exits.push_back(exit);
-}
-
-/**
-* set the start point node to the 2D map.
-* @param startPoint: it indicate a pointer of which node is the start point node in map.
+* @param row: the row of the exit node in map.
+* @param col: the column of the exit node in map.
 */
-void LevelMap::setStartPoint(Block* startPoint)
-{
-   this->startPoint = startPoint;
-}
-
-/**
-* set the target point node to the 2D map.
-* @param targetPoint: it indicate a pointer of which node is the target point node in map.
-*/
-void LevelMap::setTargetPoint(Block* targetPoint)
-{
-   this->targetPoint = targetPoint;
+void LevelMap::addExit(int row, int col){
+   exits.push_back(std::make_pair(row, col));
 }
 
 /**
@@ -87,7 +93,7 @@ void LevelMap::setTargetPoint(Block* targetPoint)
 */
 void LevelMap::setStartPoint(int row, int col)
 {
-   startPoint = &map[row][col];
+   startPoint = row * cols + col;
 }
 
 /**
@@ -97,25 +103,25 @@ void LevelMap::setStartPoint(int row, int col)
 */
 void LevelMap::setTargetPoint(int row, int col)
 {
-   targetPoint = &map[row][col];
+   targetPoint = row * cols + col;
 }
 
 /**
-* get the start point node to the 2D map.
-* @return startPoint: it indicate a pointer of which node is the start point node in map.
+* get the start point node of the 2D map.
+* @return startPoint: the row and column of the start point, -1, -1 if it is not set.
 */
-Block* LevelMap::getStartPoint()
+std::pair<int, int> LevelMap::getStartPoint() const
 {
-   return startPoint;
+   return startPoint < 0 ? std::make_pair(-1, -1) : std::make_pair(startPoint / cols, startPoint % cols);
 }
 
 /**
-* get the target point node to the 2D map.
-* @return target: it indicate a pointer of which node is the target point node in map.
+* get the target point node of the 2D map.
+* @return target: the row and column of the target point, -1, -1 if it is not set.
 */
-Block* LevelMap::getTargetPoint()
+std::pair<int, int> LevelMap::getTargetPoint() const
 {
-   return targetPoint;
+   return targetPoint < 0 ? std::make_pair(-1, -1) : std::make_pair(targetPoint / cols, targetPoint % cols);
 }
 
 /**
@@ -124,41 +130,272 @@ Block* LevelMap::getTargetPoint()
 * @param col: it indicate which column the node is in map.
 * @return block: it is the pointer reference of selected node.
 */
-Block* LevelMap::findBlockInMap(int row, int col)
+const Block* LevelMap::findBlockInMap(int row, int col) const
 {
-   return &map[row][col];
+   return getNode(row, col);
 }
 
 /**
 * find the walls information on the map.
 * @return walls: it is a list of walls location on map.
 */
-std::vector<std::pair<int, int>> LevelMap::getWallsInfo() {
+std::vector<std::pair<int, int>> LevelMap::getWallsInfo() const {
    std::vector<std::pair<int, int>> walls;
-   for(int i = 0; i < map.size(); i++) {
-      for(int j = 0; j < map[i].size(); j++) {
-         Block node = map[i][j];
-         if(node.getType() == 5) {
-            std::pair<int, int> wall(i, j);
-            walls.push_back(wall);
-         }
+   for(int i = 0; i < (int) blocks.size(); i++) {
+      if(blocks[i].getType() == 5) {
+         walls.push_back(std::make_pair(i / cols, i % cols));
       }
    }
    return walls;
 }
 
 /**
-* It reset the map's blocks settings after run the algorithm.
+* Turn every wall on the map back into a normal block.
+* @return walls: the location of the blocks that were walls, so only those need repainting.
+*/
+std::vector<std::pair<int, int>> LevelMap::clearWalls() {
+   std::vector<std::pair<int, int>> walls = getWallsInfo();
+   for(std::pair<int, int> wall: walls) {
+      setBlockType(wall.first, wall.second, 1);
+   }
+   return walls;
+}
+
+/**
+* Bytes used by the map: the blocks, the graphs of its walkable blocks and the lists of entrances and exits.
+* @return bytes: the memory held by the map.
+*/
+long LevelMap::getMemoryBytes()
+{
+   return sizeof(LevelMap) - sizeof(GraphView) - sizeof(ChainGraph) + blocks.capacity() * sizeof(Block) + graph.getMemoryBytes()
+      + chains.getMemoryBytes()
+      + (entrances.capacity() + exits.capacity()) * sizeof(std::pair<int, int>);
+}
+
+/**
+* Change the type of a block, keeping the version of the map up to date.
+* @param row: the row of the block.
+* @param col: the column of the block.
+* @param type: the new type, 5 for walls.
+*/
+void LevelMap::setBlockType(int row, int col, int type)
+{
+   Block& block = blocks[row * cols + col];
+   if(versionKnown) {
+      int index = row * cols + col;
+      int weight = getWeight(row, col);
+      version ^= blockKey(index, block.getType(), weight) ^ blockKey(index, type, weight);
+   }
+   if((block.getType() == 5) != (type == 5)) {
+      graphKnown = false;
+      chainsKnown = false;
+   }
+   block.setType(type);
+}
+
+/**
+* Change the weight of a block, keeping the version of the map up to date. While the overlay changes the
+* weight of the block, searches keep using the weight of the overlay.
+* @param row: the row of the block.
+* @param col: the column of the block.
+* @param weight: the new weight, the cost of entering the block, from 0 to 255; others are clamped, see Block::setWeight.
+*/
+void LevelMap::setBlockWeight(int row, int col, int weight)
+{
+   Block& block = blocks[row * cols + col];
+   int previous = block.getWeight();
+   block.setWeight(weight);
+   weight = block.getWeight();
+   bool laid = overlay && overlay->findWeight(row, col) >= 0;
+   if(versionKnown && !laid) {
+      int index = row * cols + col;
+      version ^= blockKey(index, block.getType(), previous) ^ blockKey(index, block.getType(), weight);
+   }
+   if(block.getType() != 5 && !laid) {
+      if(graphKnown) {
+         graph.setWeight(graph.getNode(row, col), weight);
+      }
+      // the cost of the corridor the block is in changes
+      costsKnown = false;
+   }
+}
+
+/**
+* Lay weights over the blocks, replacing the overlay laid before. The blocks keep their own weights, which
+* come back when the overlay is taken away. The corridors of the map are not built again: their costs are
+* customized before the next search, in one pass over the blocks.
+* @param overlay: the weights, null for none. The map keeps it while it is laid, so it may not change.
+*/
+void LevelMap::setOverlay(std::shared_ptr<const WeightOverlay> overlay)
+{
+   if(overlay == this->overlay) {
+      return;
+   }
+   std::shared_ptr<const WeightOverlay> previous = std::move(this->overlay);
+   this->overlay = std::move(overlay);
+   versionKnown = false;
+   if(!graphKnown) {
+      return;
+   }
+   // the blocks of the previous overlay get their own weights back unless the new one changes them too
+   for(const WeightOverlay* laid: {previous.get(), this->overlay.get()}) {
+      if(!laid) {
+         continue;
+      }
+      for(const OverlayChange& change: laid->changes) {
+         int node = graph.getNode(change.row, change.col);
+         if(node >= 0) {
+            graph.setWeight(node, getWeight(change.row, change.col));
+         }
+      }
+   }
+   costsKnown = false;
+}
+
+/**
+* Return the weight searches use for a block: the weight of the overlay if it changes the block, else its own.
+* @param row: the row of the block.
+* @param col: the column of the block.
+* @return weight: the cost of entering the block, GraphView::CLOSED if it is closed.
+*/
+int LevelMap::getWeight(int row, int col) const
+{
+   int laid = overlay ? overlay->findWeight(row, col) : -1;
+   return laid >= 0 ? laid : blocks[row * cols + col].getWeight();
+}
+
+/**
+* Return the version of the map: a hash of its size and of the walls and weights of every block, with the
+* weights of the overlay. Two maps with the same content have the same version, so searches on them give
+* the same result. Blocks must be edited with setBlockType and setBlockWeight for the version to follow.
+* @return version: the content hash of the map.
+*/
+unsigned long long LevelMap::getVersion()
+{
+   if(!versionKnown) {
+      version = blockKey(-1, 0, rows * 65536 + cols);
+      for(int i = 0; i < (int) blocks.size(); i++) {
+         version ^= blockKey(i, blocks[i].getType(), blocks[i].getWeight());
+      }
+      if(overlay) {
+         for(const OverlayChange& change: overlay->changes) {
+            if(change.row < rows && change.col < cols) {
+               int i = change.row * cols + change.col;
+               version ^= blockKey(i, blocks[i].getType(), blocks[i].getWeight()) ^ blockKey(i, blocks[i].getType(), change.weight);
+            }
+         }
+      }
+      versionKnown = true;
+   }
+   return version;
+}
+
+/**
+* Return the graph of the walkable blocks of the map, the structure searches run on, with the weights of the overlay.
+* Its tables are mapped from the installed MapSnapshot when it has them for the walls of the map.
+* Blocks must be edited with setBlockType and setBlockWeight for the graph to follow.
+* @return graph: the walkable blocks and the edges between them.
+*/
+const GraphView& LevelMap::getGraph()
+{
+   if(!graphKnown) {
+      if(!mapTables()) {
+         graph.build(rows, cols, blocks);
+      }
+      if(overlay) {
+         for(const OverlayChange& change: overlay->changes) {
+            int node = graph.getNode(change.row, change.col);
+            if(node >= 0) {
+               graph.setWeight(node, change.weight);
+            }
+         }
+      }
+      graphKnown = true;
+   }
+   return graph;
+}
+
+/**
+* Return the graph of the junctions of the map, with the corridors between them contracted into edges.
+* It is built again only after walls were added or removed: after weights changed its costs are customized.
+* Blocks must be edited with setBlockType and setBlockWeight for the chains to follow.
+* @return chains: the junctions and corridors of the map.
 */
-void LevelMap::resetMapBlocks() {  
-   for(int row = 0; row < 20; row++) {
-      for(int col = 0; col < 52; col++) {
-            Block* currNode = &map[row][col];
-            currNode->setInQueue(false);
-            currNode->setMinDistance(10000);
-            currNode->setWeight(1);
-            currNode->setPrevBlock(nullptr);
-            currNode->setVisit(false);
+const ChainGraph& LevelMap::getChains()
+{
+   // a graph mapped from a snapshot maps the chains with it
+   const GraphView& walkable = getGraph();
+   if(!chainsKnown) {
+      chains.build(walkable);
+      chainsKnown = true;
+      costsKnown = true;
+   } else if(!costsKnown) {
+      chains.customize(walkable);
+      costsKnown = true;
+   }
+   return chains;
+}
+
+/**
+* Return a hash of the size of the map and of where its walls are, which decide the tables of its graphs.
+* @return wallsVersion: the key of the tables in a MapSnapshot.
+*/
+unsigned long long LevelMap::getWallsVersion() const
+{
+   unsigned long long wallsVersion = blockKey(-1, 0, rows * 65536 + cols);
+   for(int i = 0; i < (int) blocks.size(); i++) {
+      if(blocks[i].getType() == 5) {
+         wallsVersion ^= blockKey(i, 5, 0);
       }
    }
-}
\ No newline at end of file
+   return wallsVersion;
+}
+
+/**
+* Use the tables of the installed snapshot for both graphs if it has them for the walls of the map. The costs
+* of the chains are customized when they are first used.
+* @return true if the tables were mapped, false if the graphs must be built.
+*/
+bool LevelMap::mapTables()
+{
+   snapshot = MapSnapshot::getInstalled();
+   SnapshotReader tables;
+   if(snapshot && snapshot->findTables(getWallsVersion(), tables) && graph.mapTables(tables, rows, cols, blocks)
+      && chains.mapTables(tables, graph)) {
+      chainsKnown = true;
+      costsKnown = false;
+      return true;
+   }
+   snapshot = nullptr;
+   return false;
+}
+
+/**
+* Write the tables of both graphs of the map to a snapshot, building them first if they are not yet.
+* @param out: the snapshot being written.
+*/
+void LevelMap::saveTables(SnapshotWriter& out)
+{
+   getChains();
+   graph.saveTables(out);
+   chains.saveTables(out);
+}
+
+/**
+* Random looking key of a block state for the version hash. Only walls and weights change a search,
+* so every other type hashes like an open block.
+* @param index: the position of the block, row by row.
+* @param type: the type of the block.
+* @param weight: the weight of the block.
+* @return key: the key of the block state.
+*/
+unsigned long long LevelMap::blockKey(int index, int type, int weight)
+{
+   // a closed block can still be left, so it hashes apart from walls
+   unsigned long long state = type == 5 ? 0 : weight == GraphView::CLOSED ? 256 : weight;
+   // splitmix64 of the position and the state
+   unsigned long long key = ((unsigned long long) (unsigned int) index << 32 | state) + 0x9e3779b97f4a7c15ULL;
+   key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9ULL;
+   key = (key ^ (key >> 27)) * 0x94d049bb133111ebULL;
+   return key ^ (key >> 31);
+}
@@ -6,8 +6,16 @@
 #ifndef LEVELMAP_H
 #define LEVELMAP_H
 #pragma once
+#include <memory>
+#include <utility>
 #include <vector>
 #include "Block.h"
+#include "ChainGraph.h"
+#include "GraphView.h"
+#include "WeightOverlay.h"
+
+class MapSnapshot;
+class SnapshotWriter;
 
 class LevelMap
 {
@@ -16,41 +24,16 @@ class LevelMap
         * Constructor that initilaize the classic board
         */
        LevelMap() {
-           for(int row = 0; row < 20; row++) {
-               std::vector<Block> rowData;
-               for(int col = 0; col < 52; col++) {
-                   Block item = Block(row, col);
-                   rowData.push_back(item);
-               }
-               map.push_back(rowData);
-           }
-           for(int row = 0; row < 20; row++) {
-               for(int col = 0; col < 52; col++) {
-                   Block* currNode = &map[row][col];
-                   int prevRow = row - 1;
-                   int nextRow = row + 1;
-                   int prevCol = col - 1;
-                   int nextCol = col + 1;
-                   if(prevRow >= 0) {
-                       currNode->setNeighbour(&map[row-1][col]);
-                   }
-                   if(nextRow < 20) {
-                       currNode->setNeighbour(&map[row+1][col]);
-                   }
-                   if(prevCol >= 0) {
-                       currNode->setNeighbour(&map[row][col-1]);
-                   }
-                   if(nextCol < 52) {
-                       currNode->setNeighbour(&map[row][col+1]);
-                   }
-               }
-           }
-           setStartPoint(&map[10][12]);
-           setTargetPoint(&map[10][40]);
+           rows = 20;
+           cols = 52;
+           blocks.assign(rows * cols, Block());
+           setStartPoint(10, 12);
+           setTargetPoint(10, 40);
        }
+       LevelMap(int rows, int cols);
        LevelMap(std::vector<std::vector<Block>> map) {
            // take map to initialize level map
-           this->map = map;
+           setMap(std::move(map));
        }
        /*
         * Constructor that initilaize the campus map board
@@ -70,83 +53,82 @@ class LevelMap
             };
             
             std::vector<std::pair<int, int>> entrances = {
-                {23, 74}, {30, 59}, {39, 93}, {48,77}, {59,78}, {49,99}, {60,105}, {51,102}, {55,93}, {77,82}, {86,75}, {95,85}, {98,68}, {118,69}, {113,59}, {68,73}, {78,50}, {82,36}, {86,49}, {111,32}, {15,99}, {32,109}, {41,120}, {47, 123}, {49, 130}, {60,113}, {74,93}, {77,101}, {70,124}, {75,128}, {92,135}, {41,137}, {70,151}, {81,148}, {91,151}, {120,119}, {143,103}, {121,93}, {123,85}, {136,76}, {154,75}, {138,58}, {136,41}, {136,35}, {157,29}, {165,12}, {146,36}, {179,24}, {179,26}, {158,24}
+                {23, 74}, {30, 59}, {39, 93}, {48,77}, {59,78}, {49,99}, {60,105}, {51,102}, {55,93}, {77,82}, {86,75}, {95,85}, {98,68}, {118,69}, {113,59}, {68,73}, {78,50}, {82,36}, {86,49}, {111,32}, {15,99}, {32,109}, {41,120}, {47, 123}, {49, 130}, {60,113}, {74,93}, {77,101}, {70,124}, {75,128}, {92,135}, {41,137}, {70,151}, {81,148}, {91,151}, {120,119}, {143,103}, {121,93}, {123,85}, {136,76}, {154,75}, {138,58}, {136,41}, {136,35}, {157,29}, {165,12}, {146,36}, {179,24}, {179,26}, {158,24}, {34,94}
             };
-            for(int row = 0; row < 200; row++) {
-                std::vector<Block> rowData;
-                for(int col = 0; col < 168; col++) {
-                    Block item = Block(row, col, 5);
-                    rowData.push_back(item);
-                }
-                map.push_back(rowData);
-            }
-            for(int row = 0; row < 200; row++) {
-                for(int col = 0; col < 168; col++) {
-                    Block* currNode = &map[row][col];
-                    int prevRow = row - 1;
-                    int nextRow = row + 1;
-                    int prevCol = col - 1;
-                    int nextCol = col + 1;
-                    if(prevRow >= 0) {
-                        currNode->setNeighbour(&map[row-1][col]);
-                    }
-                    if(nextRow < 200) {
-                        currNode->setNeighbour(&map[row+1][col]);
-                    }
-                    if(prevCol >= 0) {
-                        currNode->setNeighbour(&map[row][col-1]);
-                    }
-                    if(nextCol < 168) {
-                        currNode->setNeighbour(&map[row][col+1]);
-                    }
+            rows = 200;
+            cols = 168;
+            blocks.assign(rows * cols, Block(5));
+            for(const std::vector<std::pair<int, int>>* cells: {&path, &path2, &path3, &entrances}) {
+                for(std::pair<int, int> item: *cells) {
+                    blocks[item.first * cols + item.second].setType(1);
                 }
             }
-            for(std::pair<int, int> item: path) {
-                Block* node = &map[item.first][item.second];
-                node->setType(1);
-            }
-            for(std::pair<int, int> item: path2) {
-                Block* node = &map[item.first][item.second];
-                node->setType(1);
-            }
-            for(std::pair<int, int> item: path3) {
-                Block* node = &map[item.first][item.second];
-                node->setType(1);
-            }
-            for(std::pair<int, int> item: entrances) {
-                Block* node = &map[item.first][item.second];
-                node->setType(1);
-            }
         }
        }
        void setMap(std::vector<std::vector<Block>> map);
-       std::vector<std::vector<Block>> getMap();
-       Block* getNode(int row, int col);
+       const std::vector<Block>& getMap() const;
+       const Block* getNode(int row, int col) const {
+           return &blocks[row * cols + col];
+       }
+       int getRows() const {
+           return rows;
+       }
+       int getColumns() const {
+           return cols;
+       }
        void setFloor(int level);
-       void addEntrance(Block* entrance);
-       void addExit(Block* exit);
-       int getFloor();
+       void addEntrance(int row, int col);
+       void addExit(int row, int col);
+       int getFloor() const;
        // void setStartPosCost(int cost);
-       void setStartPoint(Block* startPoint);
-       void setTargetPoint(Block* targetPoint);
        void setStartPoint(int row, int col);
        void setTargetPoint(int row, int col);
-       Block* getStartPoint();
-       Block* getTargetPoint();
-       Block* findBlockInMap(int row, int col);
-       std::vector<std::pair<int, int>> getWallsInfo();
-       void resetMapBlocks();
+       std::pair<int, int> getStartPoint() const;
+       std::pair<int, int> getTargetPoint() const;
+       const Block* findBlockInMap(int row, int col) const;
+       std::vector<std::pair<int, int>> getWallsInfo() const;
+       std::vector<std::pair<int, int>> clearWalls();
+       long getMemoryBytes();
+       void setBlockType(int row, int col, int type);
+       void setBlockWeight(int row, int col, int weight);
+       void setOverlay(std::shared_ptr<const WeightOverlay> overlay);
+       int getWeight(int row, int col) const;
+       unsigned long long getVersion();
+       unsigned long long getWallsVersion() const;
+       const GraphView& getGraph();
+       const ChainGraph& getChains();
+       void saveTables(SnapshotWriter& out);
 
    private:
-       // this is the map for this flat floor
-       std::vector<std::vector<Block>> map;
+       // this is the map for this flat floor, row by row: the block at row, col is blocks[row * cols + col]
+       std::vector<Block> blocks;
+       int rows = 0;
+       int cols = 0;
        // this indicate which floor this map located inside building
        int floor;
        // this is the specific building map
-       std::vector<Block*> entrances;
+       std::vector<std::pair<int, int>> entrances;
        // this is the specific building map
-       std::vector<Block*> exits;
-       Block* startPoint;
-       Block* targetPoint;
+       std::vector<std::pair<int, int>> exits;
+       // start and target as row * cols + col, -1 until they are set
+       int startPoint = -1;
+       int targetPoint = -1;
+       // the weights laid over the blocks, null for none
+       std::shared_ptr<const WeightOverlay> overlay;
+       // hash of the walls and weights of the map, computed on first use and then kept up to date by every edit
+       unsigned long long version = 0;
+       bool versionKnown = false;
+       // the walkable blocks as searched, built on first use and again after walls were added or removed
+       GraphView graph;
+       bool graphKnown = false;
+       // the graph with its corridors contracted, built with the graph, and its costs, customized again after
+       // weights changed
+       ChainGraph chains;
+       bool chainsKnown = false;
+       bool costsKnown = false;
+       // the snapshot the tables of both graphs were mapped from, kept open while they are used, null if they were built
+       std::shared_ptr<const MapSnapshot> snapshot;
+       bool mapTables();
+       static unsigned long long blockKey(int index, int type, int weight);
 };
 #endif
\ No newline at end of file
@@ -0,0 +1,365 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: Load test of the web application: many sessions in one process, driven like browsers would.
+*
+* Usage: naviLoad [--sessions n,n,...] [--rounds n] [--json file]
+* For every number of sessions, that many Interface applications are opened in Wt's test environment and
+* each runs the same script for a number of rounds: drawing walls and visualizing on the classic board,
+* switching to the campus, picking two buildings and visualizing, clearing and switching back. The events
+* of all sessions are interleaved, one event of every session in turn, as users clicking at the same time.
+* It reports the heap held by a session, the estimate the session reports to /metrics when it opens and after
+* the rounds, the latency percentiles of the events and the events handled per second, and writes the same
+* numbers as JSON.
+* Nothing is sent to a browser in the test environment, so the JavaScript updates of a session stay queued
+* in it; the heap after the rounds includes them and is an upper bound.
+*/
+
+#include <Wt/Test/WTestEnvironment.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <malloc.h>
+#include <memory>
+#include <new>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <sys/resource.h>
+#include "BuildingDictionary.h"
+#include "Interface.h"
+
+// GCC takes the malloc and free of the replaced operators below, once inlined, for a mismatched pair
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+// the heap held by the whole process, sessions and Wt included
+static std::atomic<long> liveBytes(0);
+
+void* operator new(std::size_t size) {
+    void* memory = std::malloc(size == 0 ? 1 : size);
+    if(!memory) {
+        throw std::bad_alloc();
+    }
+    liveBytes.fetch_add(malloc_usable_size(memory), std::memory_order_relaxed);
+    return memory;
+}
+
+void operator delete(void* memory) noexcept {
+    if(memory) {
+        liveBytes.fetch_sub(malloc_usable_size(memory), std::memory_order_relaxed);
+    }
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    operator delete(memory);
+}
+
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic pop
+#endif
+
+// the kinds of events of the script, reported separately
+enum EventKind { WALL, VISUALIZE, CLEAR, SWITCH, BUILDING, EVENT_KINDS };
+static const char* const EVENT_NAMES[EVENT_KINDS] = {"wall", "visualize", "clear", "switch", "building"};
+
+/**
+* Fires the signals of the widgets of a session, as the events of a browser would. Interface makes it a
+* friend for this; the handlers that run are the ones connected to the widgets. Every event goes through
+* Interface::handleEvent, like the events of a browser through notify, so it is traced in a request span and
+* the memory of the session is measured and reported after it.
+*/
+class SessionScript {
+    public:
+        static void drawWall(Interface& app, int row, int col) {
+            app.handleEvent([&app, row, col]() { app.mapContainer_->elementAt(row, col)->mouseDragged().emit(Wt::WMouseEvent()); });
+        }
+        static void visualize(Interface& app) {
+            app.handleEvent([&app]() { app.visualizeButton_->clicked().emit(Wt::WMouseEvent()); });
+        }
+        static void clearBoard(Interface& app) {
+            app.handleEvent([&app]() { app.clearBoardButton_->clicked().emit(Wt::WMouseEvent()); });
+        }
+        static void switchBoard(Interface& app, int mapType) {
+            Wt::WMenuItem* item = mapType == 0 ? app.classicBoardItem_ : app.campusBoardItem_;
+            app.handleEvent([item]() { item->triggered().emit(item); });
+        }
+        static void clickBuilding(Interface& app, int row, int col) {
+            app.handleEvent([&app, row, col]() { app.campusMapContainer_->cellClicked().emit(row, col); });
+        }
+        static void toggleSelector(Interface& app) {
+            app.handleEvent([&app]() { app.changeSelectorButton_->clicked().emit(Wt::WMouseEvent()); });
+        }
+        // the bytes the session last reported to the metrics and the memory ledger
+        static long getEstimatedBytes(const Interface& app) {
+            return app.sessionMemory_.getTotal();
+        }
+};
+
+/**
+* One simulated user: a test environment with its own Wt session and the application running in it.
+*/
+struct LoadSession {
+    std::unique_ptr<Wt::Test::WTestEnvironment> environment;
+    std::unique_ptr<Interface> application;
+    std::mt19937 random;
+};
+
+/**
+* Results for one number of sessions.
+*/
+struct LoadMeasurement {
+    int sessions;
+    int rounds;
+    double openMsPerSession;
+    double heapBytesPerSession;
+    double busyHeapBytesPerSession;
+    double estimatedBytesPerSession;
+    double busyEstimatedBytesPerSession;
+    long events;
+    double eventsPerSecond;
+    // latencies of every event, and of every kind of event, in nanoseconds
+    std::vector<long> latencies;
+    std::vector<long> kindLatencies[EVENT_KINDS];
+    long peakRssKb;
+};
+
+/**
+* Returns the peak resident set size of the process.
+* @return peak: the peak RSS in kilobytes.
+*/
+static long peakRssKb() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+/**
+* Returns a percentile of sorted latencies.
+* @param sorted: the latencies in increasing order.
+* @param fraction: the percentile as a fraction, 0.5 for the median.
+* @return latency: the latency in microseconds, 0 without latencies.
+*/
+static double percentileUs(const std::vector<long>& sorted, double fraction) {
+    if(sorted.empty()) {
+        return 0;
+    }
+    size_t index = std::min(sorted.size() - 1, (size_t) (fraction * sorted.size()));
+    return sorted[index] / 1000.0;
+}
+
+/**
+* Builds the steps of one round of the script. A step is one event of every session in turn.
+* @return steps: the kind of every step, in order.
+*/
+static std::vector<EventKind> createRound() {
+    std::vector<EventKind> steps;
+    for(int i = 0; i < 8; i++) {
+        steps.push_back(WALL);
+    }
+    // visualize and clear the classic board, then pick a start and a target building on the campus
+    steps.insert(steps.end(), {VISUALIZE, CLEAR, SWITCH, BUILDING, BUILDING, BUILDING, VISUALIZE, CLEAR, SWITCH});
+    return steps;
+}
+
+/**
+* Runs one step of the script in a session, inside a request of its Wt session.
+* @param session: the session.
+* @param round: the steps of a round.
+* @param step: the index of the step in the round.
+*/
+static void runStep(LoadSession& session, const std::vector<EventKind>& round, size_t step) {
+    Interface& app = *session.application;
+    const BuildingDictionary& dictionary = BuildingDictionary::getInstance();
+    std::uniform_int_distribution<int> pickBuilding(0, dictionary.getBuildingCount() - 1);
+    session.environment->startRequest();
+    switch(round[step]) {
+        case WALL:
+            SessionScript::drawWall(app, session.random() % 20, session.random() % 52);
+            break;
+        case VISUALIZE:
+            SessionScript::visualize(app);
+            break;
+        case CLEAR:
+            SessionScript::clearBoard(app);
+            break;
+        case SWITCH:
+            // to the campus before the buildings are picked, back to the classic board at the end of the round
+            SessionScript::switchBoard(app, step + 1 < round.size() && round[step + 1] == BUILDING ? 1 : 0);
+            break;
+        case BUILDING:
+            // a building, then the selector to the target, then the target building
+            if(round[step - 1] == BUILDING && round[step + 1] == BUILDING) {
+                SessionScript::toggleSelector(app);
+            } else {
+                const FootprintSpan& span = dictionary.getBuildings()[pickBuilding(session.random)].getFootprint().front();
+                SessionScript::clickBuilding(app, span.row, span.colBegin);
+            }
+            break;
+        default:
+            break;
+    }
+    session.environment->endRequest();
+}
+
+/**
+* Opens a number of sessions, runs the script in all of them and closes them again.
+* @param sessionCount: the number of sessions.
+* @param rounds: the number of rounds of the script every session runs.
+* @return measurement: the memory, latencies and throughput.
+*/
+static LoadMeasurement runLoad(int sessionCount, int rounds) {
+    LoadMeasurement measurement;
+    measurement.sessions = sessionCount;
+    measurement.rounds = rounds;
+
+    // the heap of the applications only, not of the test environments around them
+    std::vector<LoadSession> sessions(sessionCount);
+    long estimated = 0;
+    long heap = 0;
+    long openNs = 0;
+    for(int i = 0; i < sessionCount; i++) {
+        LoadSession& session = sessions[i];
+        session.environment.reset(new Wt::Test::WTestEnvironment());
+        long heapBefore = liveBytes.load();
+        auto openStart = std::chrono::steady_clock::now();
+        session.application.reset(new Interface(*session.environment));
+        openNs += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - openStart).count();
+        heap += liveBytes.load() - heapBefore;
+        session.random.seed(i + 1);
+        estimated += SessionScript::getEstimatedBytes(*session.application);
+        session.environment->endRequest();
+    }
+    measurement.openMsPerSession = openNs / 1e6 / sessionCount;
+    measurement.heapBytesPerSession = (double) heap / sessionCount;
+    measurement.estimatedBytesPerSession = (double) estimated / sessionCount;
+
+    std::vector<EventKind> round = createRound();
+    long heapBefore = liveBytes.load();
+    auto runStart = std::chrono::steady_clock::now();
+    for(int r = 0; r < rounds; r++) {
+        for(size_t step = 0; step < round.size(); step++) {
+            for(LoadSession& session: sessions) {
+                auto start = std::chrono::steady_clock::now();
+                runStep(session, round, step);
+                long elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+                measurement.latencies.push_back(elapsed);
+                measurement.kindLatencies[round[step]].push_back(elapsed);
+            }
+        }
+    }
+    long runNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - runStart).count();
+    measurement.events = measurement.latencies.size();
+    measurement.eventsPerSecond = runNs > 0 ? measurement.events * 1e9 / runNs : 0;
+    measurement.busyHeapBytesPerSession = measurement.heapBytesPerSession + (double) (liveBytes.load() - heapBefore) / sessionCount;
+    measurement.peakRssKb = peakRssKb();
+    // read again, since the graphs of both maps were built and measured by the searches of the rounds
+    long busyEstimated = 0;
+    for(LoadSession& session: sessions) {
+        busyEstimated += SessionScript::getEstimatedBytes(*session.application);
+    }
+    measurement.busyEstimatedBytesPerSession = (double) busyEstimated / sessionCount;
+
+    // an application is destroyed inside a request of its own session
+    for(LoadSession& session: sessions) {
+        session.environment->startRequest();
+        session.application.reset();
+        session.environment->endRequest();
+        session.environment.reset();
+    }
+    std::sort(measurement.latencies.begin(), measurement.latencies.end());
+    for(std::vector<long>& latencies: measurement.kindLatencies) {
+        std::sort(latencies.begin(), latencies.end());
+    }
+    return measurement;
+}
+
+/**
+* Writes the measurements as JSON.
+* @param path: the file to write.
+* @param measurements: the measurements.
+* @return true if the file was written.
+*/
+static bool writeJson(const std::string& path, const std::vector<LoadMeasurement>& measurements) {
+    std::ofstream out(path);
+    if(!out) {
+        return false;
+    }
+    out << "{\n  \"benchmark\": \"naviLoad\",\n  \"results\": [\n";
+    for(size_t i = 0; i < measurements.size(); i++) {
+        const LoadMeasurement& m = measurements[i];
+        out << "    {\"sessions\": " << m.sessions << ", \"rounds\": " << m.rounds
+            << ", \"open_ms_per_session\": " << m.openMsPerSession
+            << ", \"heap_bytes_per_session\": " << (long) m.heapBytesPerSession
+            << ", \"busy_heap_bytes_per_session\": " << (long) m.busyHeapBytesPerSession
+            << ", \"estimated_bytes_per_session\": " << (long) m.estimatedBytesPerSession
+            << ", \"busy_estimated_bytes_per_session\": " << (long) m.busyEstimatedBytesPerSession
+            << ", \"events\": " << m.events << ", \"events_per_sec\": " << (long) m.eventsPerSecond
+            << ", \"p50_us\": " << percentileUs(m.latencies, 0.5) << ", \"p95_us\": " << percentileUs(m.latencies, 0.95)
+            << ", \"p99_us\": " << percentileUs(m.latencies, 0.99) << ", \"events_by_kind\": {";
+        for(int kind = 0; kind < EVENT_KINDS; kind++) {
+            const std::vector<long>& latencies = m.kindLatencies[kind];
+            out << (kind > 0 ? ", " : "") << "\"" << EVENT_NAMES[kind] << "\": {\"events\": " << latencies.size()
+                << ", \"p50_us\": " << percentileUs(latencies, 0.5) << ", \"p95_us\": " << percentileUs(latencies, 0.95)
+                << ", \"p99_us\": " << percentileUs(latencies, 0.99) << "}";
+        }
+        out << "}, \"peak_rss_kb\": " << m.peakRssKb << "}" << (i + 1 < measurements.size() ? ",\n" : "\n");
+    }
+    out << "  ]\n}\n";
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    std::string jsonPath = "load.json";
+    std::vector<int> sessionCounts = {1, 10, 25, 50};
+    int rounds = 3;
+    for(int i = 1; i < argc; i++) {
+        if(std::strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            jsonPath = argv[++i];
+        } else if(std::strcmp(argv[i], "--rounds") == 0 && i + 1 < argc) {
+            rounds = std::max(1, std::atoi(argv[++i]));
+        } else if(std::strcmp(argv[i], "--sessions") == 0 && i + 1 < argc) {
+            sessionCounts.clear();
+            std::istringstream counts(argv[++i]);
+            std::string count;
+            while(std::getline(counts, count, ',')) {
+                sessionCounts.push_back(std::max(1, std::atoi(count.c_str())));
+            }
+        } else {
+            std::fprintf(stderr, "usage: %s [--sessions n,n,...] [--rounds n] [--json file]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    std::vector<LoadMeasurement> measurements;
+    std::printf("%8s %10s %12s %12s %12s %12s %8s %10s %9s %9s %9s %10s\n", "sessions", "open ms", "heap KB", "busy KB",
+                "metrics KB", "busy met. KB", "events", "events/s", "p50 us", "p95 us", "p99 us", "peak KB");
+    for(int sessionCount: sessionCounts) {
+        LoadMeasurement m = runLoad(sessionCount, rounds);
+        std::printf("%8d %10.2f %12.1f %12.1f %12.1f %12.1f %8ld %10.0f %9.1f %9.1f %9.1f %10ld\n", m.sessions, m.openMsPerSession,
+                    m.heapBytesPerSession / 1024, m.busyHeapBytesPerSession / 1024, m.estimatedBytesPerSession / 1024,
+                    m.busyEstimatedBytesPerSession / 1024, m.events, m.eventsPerSecond, percentileUs(m.latencies, 0.5), percentileUs(m.latencies, 0.95),
+                    percentileUs(m.latencies, 0.99), m.peakRssKb);
+        for(int kind = 0; kind < EVENT_KINDS; kind++) {
+            const std::vector<long>& latencies = m.kindLatencies[kind];
+            std::printf("%8s %-10s %60ld %20.1f %9.1f %9.1f\n", "", EVENT_NAMES[kind], (long) latencies.size(),
+                        percentileUs(latencies, 0.5), percentileUs(latencies, 0.95), percentileUs(latencies, 0.99));
+        }
+        measurements.push_back(m);
+    }
+    if(!writeJson(jsonPath, measurements)) {
+        std::fprintf(stderr, "could not write %s\n", jsonPath.c_str());
+        return 1;
+    }
+    std::printf("wrote %s\n", jsonPath.c_str());
+    return 0;
+}
@@ -5,7 +5,13 @@
 */
 
 #include "LogicServer.h"
-#include "Interface.h"
+#include <algorithm>
+#include <chrono>
+#include "AlternativeRoutes.h"
+#include "PhaseTracer.h"
+#include "RouteCache.h"
+#include "SearchMetrics.h"
+#include "WeightOverlay.h"
 using namespace std;
 
 /**
@@ -13,11 +19,11 @@ using namespace std;
 * @param type: The algorithm chosen; 0 for Dikjstra, 1 for A*.
 */
 void LogicServer::setAlgorithm(int type, Board* board) {
-    AlgorithmFactory* factory;
+    board_ = board;
     if(type != this->type) {
         this->type = type;
         delete algorithmInstance_;
-        algorithmInstance_ = factory->createAlgorithmInstance(type, board);
+        algorithmInstance_ = AlgorithmFactory::createAlgorithmInstance(type, board);
     }
 }
 
@@ -25,14 +31,187 @@ void LogicServer::setAlgorithm(int type, Board* board) {
  * Returns the algorithm type.
  * @return type: the algorithm type.
 */
-int LogicServer::getAlgorithmType() {
+int LogicServer::getAlgorithmType() const {
    return type;
 }
 
 /**
-* Runs the search algorithm based on type.
+* Runs the search algorithm based on type and counts it in the metrics.
+* A search that was run before on a map with the same walls and weights is answered from the route cache,
+* and a search that another session is running at the same time is waited for instead of run twice.
+* The result is shared, not copied: it stays valid until the next search of this server or of the thread.
 * @param mapContainer: The map instance.
 */
-pair<vector<pair<int, int>>, vector<pair<int, int>>> LogicServer::runAlgorithm() {
-    return algorithmInstance_->runAlgorithm();
+const pair<vector<pair<int, int>>, vector<pair<int, int>>>& LogicServer::runAlgorithm() {
+    TraceSpan span(PHASE_SEARCH, board_->getMapType());
+    useLatestOverlay();
+    LevelMap* map = board_->getMap();
+    pair<int, int> startBlock = map->getStartPoint();
+    pair<int, int> targetBlock = map->getTargetPoint();
+    RouteKey key = {map->getVersion(), startBlock.first, startBlock.second, targetBlock.first, targetBlock.second, type, {}, {}};
+    return runCached(key, nullptr, nullptr);
+}
+
+/**
+* Answers a search from the route cache, waits for the same search running on another thread, or runs it,
+* counts it in the metrics and caches it.
+* @param key: the search, only read when the cache is enabled.
+* @param starts: the starts of a search between sets of blocks, nullptr for the start of the map.
+* @param targets: the targets of a search between sets of blocks, nullptr for the target of the map.
+* @return result: the blocks visited and the route, valid until the next search of this server or of the thread.
+*/
+const pair<vector<pair<int, int>>, vector<pair<int, int>>>& LogicServer::runCached(const RouteKey& key, const vector<pair<int, int>>* starts,
+                                                                                   const vector<pair<int, int>>* targets) {
+    shared_ptr<RouteCache::Flight> flight;
+    if(cacheEnabled) {
+        lastEntry = RouteCache::getInstance().findOrLead(key, flight);
+        if(lastEntry) {
+            lastStats = lastEntry->stats;
+            return lastEntry->result;
+        }
+    }
+
+    const pair<vector<pair<int, int>>, vector<pair<int, int>>>* result;
+    try {
+        auto start = chrono::steady_clock::now();
+        result = starts ? &algorithmInstance_->findRoute(*starts, *targets) : &algorithmInstance_->runAlgorithm();
+        long elapsedNs = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count();
+        lastStats = algorithmInstance_->getLastStats();
+        SearchMetrics::recordSearch(type, board_->getMapType(), lastStats, elapsedNs);
+    } catch(...) {
+        // the sessions waiting for this search run it themselves
+        if(flight) {
+            RouteCache::getInstance().finish(key, flight, nullptr);
+        }
+        throw;
+    }
+    if(flight) {
+        RouteCache::getInstance().finish(key, flight, RouteCache::makeEntry(*result, lastStats, board_->getMap()->getColumns()));
+    }
+    return *result;
+}
+
+/**
+* Finds the routes from the start of the map to the nearest of several targets, see the other findNearest.
+* @param targets: the targets as row and column.
+* @param count: how many of the nearest targets to find, 0 for all of them.
+* @return routes: the routes to the targets found, nearest first.
+*/
+const vector<NearestRoute>& LogicServer::findNearest(const vector<pair<int, int>>& targets, int count) {
+    return findNearest(board_->getMap()->getStartPoint(), targets, count);
+}
+
+/**
+* Finds the routes from a start to the nearest of several targets with a single search of the chosen algorithm,
+* which stops once count targets are reached. Such searches are counted in the metrics but not cached. The routes
+* stay valid until the next search of the thread.
+* @param startBlock: the start as row and column.
+* @param targets: the targets as row and column.
+* @param count: how many of the nearest targets to find, 0 for all of them.
+* @return routes: the routes to the targets found, nearest first.
+*/
+const vector<NearestRoute>& LogicServer::findNearest(const pair<int, int>& startBlock, const vector<pair<int, int>>& targets, int count) {
+    TraceSpan span(PHASE_SEARCH, board_->getMapType());
+    useLatestOverlay();
+    auto start = chrono::steady_clock::now();
+    const vector<NearestRoute>& routes = algorithmInstance_->findNearest(startBlock, targets, count);
+    long elapsedNs = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count();
+    lastStats = algorithmInstance_->getLastStats();
+    SearchMetrics::recordSearch(type, board_->getMapType(), lastStats, elapsedNs);
+    return routes;
+}
+
+/**
+* Finds the shortest route from any of several starts to any of several targets, such as the doors of two
+* buildings, with a single search of the chosen algorithm seeded from every start. Like runAlgorithm, it is
+* answered from the route cache, keyed by both sets of blocks, or waits for the same search running on another
+* thread. The result stays valid until the next search of this server or of the thread.
+* @param starts: the starts as row and column.
+* @param targets: the targets as row and column.
+* @return result: the blocks visited and the route, which starts on one of the starts and ends on one of the targets.
+*/
+const pair<vector<pair<int, int>>, vector<pair<int, int>>>& LogicServer::findRoute(const vector<pair<int, int>>& starts, const vector<pair<int, int>>& targets) {
+    TraceSpan span(PHASE_SEARCH, board_->getMapType());
+    useLatestOverlay();
+    LevelMap* map = board_->getMap();
+    RouteKey key = {map->getVersion(), -1, -1, -1, -1, type, {}, {}};
+    // the order of the blocks and blocks given twice do not change the search; without the cache nothing is allocated
+    if(cacheEnabled) {
+        for(auto cells: {make_pair(&starts, &key.startCells), make_pair(&targets, &key.targetCells)}) {
+            for(const pair<int, int>& block: *cells.first) {
+                cells.second->push_back(block.first * map->getColumns() + block.second);
+            }
+            sort(cells.second->begin(), cells.second->end());
+            cells.second->erase(unique(cells.second->begin(), cells.second->end()), cells.second->end());
+        }
+    }
+    return runCached(key, &starts, &targets);
+}
+
+/**
+* Finds the count shortest loopless routes from the start to the target of the map, see the other findAlternatives.
+* @param count: how many routes to find.
+* @return routes: the routes found, cheapest first.
+*/
+const vector<NearestRoute>& LogicServer::findAlternatives(int count) {
+    LevelMap* map = board_->getMap();
+    return findAlternatives(map->getStartPoint(), map->getTargetPoint(), count);
+}
+
+/**
+* Finds the count shortest loopless routes between two blocks, the shortest one and the alternatives to it,
+* see AlternativeRoutes. The chosen algorithm is not used. Such searches are counted in the metrics but not
+* cached. The routes stay valid until the next search of the thread.
+* @param startBlock: the start as row and column.
+* @param targetBlock: the target as row and column.
+* @param count: how many routes to find.
+* @return routes: the routes found, cheapest first.
+*/
+const vector<NearestRoute>& LogicServer::findAlternatives(const pair<int, int>& startBlock, const pair<int, int>& targetBlock, int count) {
+    TraceSpan span(PHASE_SEARCH, board_->getMapType());
+    useLatestOverlay();
+    auto start = chrono::steady_clock::now();
+    AlternativeRoutes alternatives(*board_->getMap(), SearchWorkspace::local(), startBlock, targetBlock);
+    const vector<NearestRoute>& routes = alternatives.find(count);
+    long elapsedNs = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count();
+    lastStats = alternatives.getStats();
+    SearchMetrics::recordSearch(type, board_->getMapType(), lastStats, elapsedNs);
+    return routes;
+}
+
+/**
+* Returns the counters of the last search.
+* @return stats: expansions and queue operations of the last run.
+*/
+const SearchStats& LogicServer::getLastStats() const {
+    return lastStats;
+}
+
+/**
+* Turns the route cache on or off for this server.
+* @param enabled: false to always run the algorithm.
+*/
+void LogicServer::setCacheEnabled(bool enabled) {
+    cacheEnabled = enabled;
+}
+
+/**
+* Tells the server that its board is searched by several threads at once. Such a board is prepared before it is
+* shared: its overlay is laid and its graphs and version are computed, and searches only read it. The server then
+* lays no newer overlay over it; the owner of the board replaces it instead.
+* @param shared: true if the board is shared and read-only.
+*/
+void LogicServer::setMapShared(bool shared) {
+    mapShared = shared;
+}
+
+/**
+* Lays the newest overlay of the map type over the map before a search, so the whole search runs on one
+* version of the weights while newer ones are published. A shared map keeps the overlay it was prepared with.
+*/
+void LogicServer::useLatestOverlay() {
+    if(mapShared) {
+        return;
+    }
+    board_->getMap()->setOverlay(OverlayStore::getInstance().getOverlay(board_->getMapType()));
 }
\ No newline at end of file
@@ -9,8 +9,12 @@
 
 #include "AlgorithmFactory.h"
 #include "Block.h"
+#include <memory>
 #include <vector>
 
+struct RouteEntry;
+struct RouteKey;
+
 /**
 * Class to handle calls between the algorithm class and interface.
 */
@@ -21,15 +25,39 @@ class LogicServer
         * The constructor calls the pathfinding algorithm based on the chosen algorithm.
         */
         LogicServer(Board* board) {
-            AlgorithmFactory* factory;
             type = 0;
-            algorithmInstance_ = factory->createAlgorithmInstance(type, board);
+            board_ = board;
+            algorithmInstance_ = AlgorithmFactory::createAlgorithmInstance(type, board);
+        }
+        ~LogicServer() {
+            delete algorithmInstance_;
         }
         void setAlgorithm(int algorithmType, Board* board);
-        int getAlgorithmType();
-        std::pair<std::vector<std::pair<int, int>>, std::vector<std::pair<int, int>>> runAlgorithm();
+        int getAlgorithmType() const;
+        const std::pair<std::vector<std::pair<int, int>>, std::vector<std::pair<int, int>>>& runAlgorithm();
+        const std::vector<NearestRoute>& findNearest(const std::vector<std::pair<int, int>>& targets, int count);
+        const std::vector<NearestRoute>& findNearest(const std::pair<int, int>& startBlock, const std::vector<std::pair<int, int>>& targets, int count);
+        const std::pair<std::vector<std::pair<int, int>>, std::vector<std::pair<int, int>>>& findRoute(const std::vector<std::pair<int, int>>& starts,
+                                                                                                     const std::vector<std::pair<int, int>>& targets);
+        const std::vector<NearestRoute>& findAlternatives(int count);
+        const std::vector<NearestRoute>& findAlternatives(const std::pair<int, int>& startBlock, const std::pair<int, int>& targetBlock, int count);
+        const SearchStats& getLastStats() const;
+        void setCacheEnabled(bool enabled);
+        void setMapShared(bool shared);
     private:
         int type;
+        // answer repeated searches from the route cache, on unless a tool measures the algorithms themselves
+        bool cacheEnabled = true;
+        // the board is prepared and searched by several threads, see setMapShared
+        bool mapShared = false;
+        // counters of the last search, or of the cached search it was answered with
+        SearchStats lastStats;
+        // the cached search the last result was taken from, kept alive while the result is used
+        std::shared_ptr<const RouteEntry> lastEntry;
+        Board *board_;
         Algorithm *algorithmInstance_;
+        void useLatestOverlay();
+        const std::pair<std::vector<std::pair<int, int>>, std::vector<std::pair<int, int>>>& runCached(const RouteKey& key,
+            const std::vector<std::pair<int, int>>* starts, const std::vector<std::pair<int, int>>* targets);
 };
 #endif
\ No newline at end of file
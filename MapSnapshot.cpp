@@ -0,0 +1,181 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: Snapshot file of the graph tables of the built-in maps, mapped read-only and shared between processes.
+*/
+
+#include "MapSnapshot.h"
+#include <atomic>
+#include <cstdio>
+#include <fcntl.h>
+#include <fstream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "Board.h"
+
+namespace {
+    /**
+    * The start of a snapshot file, followed by one Entry per map and then the tables.
+    */
+    struct Header {
+        char magic[8];
+        unsigned int format;
+        // the sizes of the values written, so a file of another build is not used
+        unsigned int layout;
+        unsigned int maps;
+        unsigned int reserved;
+    };
+
+    const char MAGIC[8] = {'N', 'A', 'V', 'I', 'T', 'B', 'L', 'S'};
+    const unsigned int LAYOUT = sizeof(int) | sizeof(long) << 8 | sizeof(void*) << 16 | 0x01u << 24;
+
+    // the snapshot the maps of the process use, null for none
+    std::shared_ptr<const MapSnapshot> installed;
+}
+
+MapSnapshot::~MapSnapshot() {
+    if(data) {
+        munmap(const_cast<char*>(data), size);
+    }
+}
+
+/**
+* Maps a snapshot file read-only.
+* @param path: the file.
+* @return snapshot: the snapshot, null if the file is missing or was not written by this build.
+*/
+std::shared_ptr<const MapSnapshot> MapSnapshot::open(const std::string& path) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if(fd < 0) {
+        return nullptr;
+    }
+    struct stat status;
+    if(fstat(fd, &status) != 0 || status.st_size < (off_t) sizeof(Header)) {
+        ::close(fd);
+        return nullptr;
+    }
+    void* mapped = mmap(nullptr, status.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    // the mapping stays valid without the descriptor
+    ::close(fd);
+    if(mapped == MAP_FAILED) {
+        return nullptr;
+    }
+    std::shared_ptr<MapSnapshot> snapshot(new MapSnapshot());
+    snapshot->data = static_cast<const char*>(mapped);
+    snapshot->size = status.st_size;
+
+    Header header;
+    std::memcpy(&header, snapshot->data, sizeof(header));
+    if(std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.format != FORMAT || header.layout != LAYOUT
+       || (snapshot->size - sizeof(Header)) / sizeof(Entry) < header.maps) {
+        return nullptr;
+    }
+    snapshot->entries.resize(header.maps);
+    std::memcpy(snapshot->entries.data(), snapshot->data + sizeof(Header), header.maps * sizeof(Entry));
+    for(const Entry& entry: snapshot->entries) {
+        if(entry.offset % 8 != 0 || entry.offset > snapshot->size || entry.size > snapshot->size - entry.offset) {
+            return nullptr;
+        }
+    }
+    return snapshot;
+}
+
+/**
+* Writes the tables of maps to a snapshot file. The file is written next to the path and renamed over it, so
+* processes that mapped the previous file keep it and no process sees a file half written.
+* @param path: the file.
+* @param maps: the maps, whose graphs are built if they are not yet.
+* @return true if the file was written.
+*/
+bool MapSnapshot::write(const std::string& path, const std::vector<LevelMap*>& maps) {
+    std::vector<Entry> fileEntries;
+    SnapshotWriter tables;
+    unsigned long long begin = sizeof(Header) + maps.size() * sizeof(Entry);
+    for(LevelMap* map: maps) {
+        size_t offset = tables.getBytes().size();
+        map->saveTables(tables);
+        fileEntries.push_back({map->getWallsVersion(), begin + offset, tables.getBytes().size() - offset});
+    }
+    Header header;
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.format = FORMAT;
+    header.layout = LAYOUT;
+    header.maps = maps.size();
+    header.reserved = 0;
+
+    std::string temporary = path + "." + std::to_string(getpid()) + ".tmp";
+    {
+        std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(fileEntries.data()), fileEntries.size() * sizeof(Entry));
+        out.write(tables.getBytes().data(), tables.getBytes().size());
+        if(!out.flush()) {
+            std::remove(temporary.c_str());
+            return false;
+        }
+    }
+    if(std::rename(temporary.c_str(), path.c_str()) != 0) {
+        std::remove(temporary.c_str());
+        return false;
+    }
+    return true;
+}
+
+/**
+* Opens the snapshot of the built-in maps and installs it for the process, after writing it if the file is
+* missing or does not hold the maps as they are now.
+* @param path: the file.
+* @return snapshot: the snapshot installed, null if the file can neither be read nor written.
+*/
+std::shared_ptr<const MapSnapshot> MapSnapshot::prepare(const std::string& path) {
+    Board board;
+    std::vector<LevelMap*> maps;
+    for(int type = 0; type < 2; type++) {
+        board.switchMap(type);
+        maps.push_back(board.getMap());
+    }
+    std::shared_ptr<const MapSnapshot> snapshot = open(path);
+    SnapshotReader tables;
+    bool current = snapshot != nullptr;
+    for(LevelMap* map: maps) {
+        current = current && snapshot->findTables(map->getWallsVersion(), tables);
+    }
+    if(!current) {
+        snapshot = write(path, maps) ? open(path) : nullptr;
+    }
+    install(snapshot);
+    return snapshot;
+}
+
+/**
+* Makes the maps of the process use a snapshot from their next build on. Maps keep the snapshot they mapped.
+* @param snapshot: the snapshot, null to build every table again.
+*/
+void MapSnapshot::install(std::shared_ptr<const MapSnapshot> snapshot) {
+    std::atomic_store(&installed, snapshot);
+}
+
+/**
+* Returns the snapshot the maps of the process use.
+* @return snapshot: the installed snapshot, null if there is none.
+*/
+std::shared_ptr<const MapSnapshot> MapSnapshot::getInstalled() {
+    return std::atomic_load(&installed);
+}
+
+/**
+* Finds the tables of a map.
+* @param wallsVersion: the walls of the map, see LevelMap::getWallsVersion.
+* @param tables: set to read the tables of the map.
+* @return true if the snapshot has tables for the walls.
+*/
+bool MapSnapshot::findTables(unsigned long long wallsVersion, SnapshotReader& tables) const {
+    for(const Entry& entry: entries) {
+        if(entry.wallsVersion == wallsVersion) {
+            tables = SnapshotReader(data + entry.offset, data + entry.offset + entry.size);
+            return true;
+        }
+    }
+    return false;
+}
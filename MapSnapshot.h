@@ -0,0 +1,122 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: Snapshot file of the graph tables of the built-in maps, mapped read-only and shared between processes.
+*/
+
+#ifndef MAPSNAPSHOT_H
+#define MAPSNAPSHOT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+class LevelMap;
+
+/**
+* Appends the tables of a map to a snapshot being written: every table is its length as a 64 bit count,
+* then its values as they are in memory, padded to 8 bytes so the next table is aligned when mapped.
+*/
+class SnapshotWriter {
+    public:
+        template <typename T>
+        void append(const T* data, std::size_t count) {
+            unsigned long long length = count;
+            bytes.append(reinterpret_cast<const char*>(&length), sizeof(length));
+            bytes.append(reinterpret_cast<const char*>(data), count * sizeof(T));
+            bytes.append((8 - bytes.size() % 8) % 8, '\0');
+        }
+        std::string& getBytes() {
+            return bytes;
+        }
+    private:
+        std::string bytes;
+};
+
+/**
+* Reads the tables of one map of a mapped snapshot in the order they were written, without copying them.
+*/
+class SnapshotReader {
+    public:
+        SnapshotReader() = default;
+        SnapshotReader(const char* begin, const char* end) : at(begin), end(end) {}
+
+        /**
+        * Reads the next table.
+        * @param data: set to the values of the table, inside the snapshot.
+        * @param count: set to the number of values.
+        * @return true if the snapshot holds the whole table.
+        */
+        template <typename T>
+        bool next(const T*& data, std::size_t& count) {
+            unsigned long long length;
+            if((std::size_t) (end - at) < sizeof(length)) {
+                return false;
+            }
+            std::memcpy(&length, at, sizeof(length));
+            std::size_t left = end - at - sizeof(length);
+            if(length > left / sizeof(T)) {
+                return false;
+            }
+            data = reinterpret_cast<const T*>(at + sizeof(length));
+            count = length;
+            // the padding after the last table may be cut off
+            at += std::min<std::size_t>(sizeof(length) + (length * sizeof(T) + 7) / 8 * 8, end - at);
+            return true;
+        }
+    private:
+        const char* at = nullptr;
+        const char* end = nullptr;
+};
+
+/**
+* A snapshot file of the tables of GraphView and ChainGraph that depend only on the walls, for every built-in
+* map. It is mapped read-only, so the maps of every session, and of every process on the host that opened the
+* same file, use the same physical pages instead of building the tables each. A map uses the tables of the
+* snapshot installed in the process when its walls are the ones the tables were written for.
+* The file is written for one build on one machine: the header records the format and the sizes of the
+* values, and a file that does not match is written again.
+*/
+class MapSnapshot {
+    public:
+        // changes whenever the tables or their order change
+        static const unsigned int FORMAT = 1;
+
+        ~MapSnapshot();
+        MapSnapshot(const MapSnapshot&) = delete;
+        MapSnapshot& operator=(const MapSnapshot&) = delete;
+
+        static std::shared_ptr<const MapSnapshot> open(const std::string& path);
+        static bool write(const std::string& path, const std::vector<LevelMap*>& maps);
+        static std::shared_ptr<const MapSnapshot> prepare(const std::string& path);
+        static void install(std::shared_ptr<const MapSnapshot> snapshot);
+        static std::shared_ptr<const MapSnapshot> getInstalled();
+
+        bool findTables(unsigned long long wallsVersion, SnapshotReader& tables) const;
+        int getMapCount() const {
+            return entries.size();
+        }
+        long getBytes() const {
+            return size;
+        }
+    private:
+        /**
+        * The tables of one map in the file.
+        */
+        struct Entry {
+            unsigned long long wallsVersion;
+            unsigned long long offset;
+            unsigned long long size;
+        };
+
+        MapSnapshot() = default;
+
+        const char* data = nullptr;
+        std::size_t size = 0;
+        std::vector<Entry> entries;
+};
+
+#endif
@@ -0,0 +1,151 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: Memory of every session by the structure holding it, and of the structures the sessions share.
+*/
+
+#include "MemoryLedger.h"
+#include <memory>
+#include <sstream>
+#include "BuildingDictionary.h"
+#include "MapSnapshot.h"
+
+const char* const SessionMemory::NAMES[SessionMemory::STRUCTURES] = {
+    "board", "classic_map", "campus_map", "custom_map", "table_cells", "click_handlers", "campus_widget"
+};
+
+/**
+* Adds up the memory of every structure of the session.
+* @return bytes: the memory of the session.
+*/
+long SessionMemory::getTotal() const {
+    long total = 0;
+    for(long structure: bytes) {
+        total += structure;
+    }
+    return total;
+}
+
+/**
+* Adds up the memory of the board and its maps.
+* @return bytes: the memory of the maps of the session.
+*/
+long SessionMemory::getMapBytes() const {
+    return bytes[BOARD] + bytes[CLASSIC_MAP] + bytes[CAMPUS_MAP] + bytes[CUSTOM_MAP];
+}
+
+/**
+* Compares the memory of every structure.
+* @param other: the memory to compare with.
+* @return true if every structure holds the same bytes.
+*/
+bool SessionMemory::operator==(const SessionMemory& other) const {
+    for(int structure = 0; structure < STRUCTURES; structure++) {
+        if(bytes[structure] != other.bytes[structure]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+* Returns the ledger shared by the whole process.
+* @return ledger: the accounts of every session.
+*/
+MemoryLedger& MemoryLedger::getInstance() {
+    static MemoryLedger ledger;
+    return ledger;
+}
+
+/**
+* Opens the account of a new session, with no memory yet.
+* @return account: the number of the account, which is not the Wt session id so the ledger can be shown.
+*/
+int MemoryLedger::openSession() {
+    std::lock_guard<std::mutex> lock(mutex);
+    int account = nextAccount++;
+    accounts[account];
+    return account;
+}
+
+/**
+* Replaces the memory of a session.
+* @param account: the account of the session.
+* @param memory: the memory the session holds now.
+* @return true if the session just went over the budget, false if it was already over or is not.
+*/
+bool MemoryLedger::updateSession(int account, const SessionMemory& memory) {
+    long limit = budget.load();
+    std::lock_guard<std::mutex> lock(mutex);
+    auto found = accounts.find(account);
+    if(found == accounts.end()) {
+        return false;
+    }
+    found->second.memory = memory;
+    bool over = limit > 0 && memory.getTotal() > limit;
+    bool crossed = over && !found->second.overBudget;
+    found->second.overBudget = over;
+    return crossed;
+}
+
+/**
+* Closes the account of a session that ended.
+* @param account: the account of the session.
+*/
+void MemoryLedger::closeSession(int account) {
+    std::lock_guard<std::mutex> lock(mutex);
+    accounts.erase(account);
+}
+
+/**
+* Sets the memory a session may hold before it is reported. Sessions already over it are reported
+* at their next update.
+* @param bytes: the budget of a session, 0 for none.
+*/
+void MemoryLedger::setBudget(long bytes) {
+    budget = bytes > 0 ? bytes : 0;
+}
+
+/**
+* Returns the budget of a session.
+* @return bytes: the budget, 0 for none.
+*/
+long MemoryLedger::getBudget() const {
+    return budget.load();
+}
+
+/**
+* Writes the memory of every session, by structure, the sums over all sessions and the shared memory as JSON.
+* @return text: {"budget_bytes":b,"total_bytes":t,"sessions":n,"structures":{...},"shared":{...},"per_session":[...]}
+*/
+std::string MemoryLedger::renderJson() const {
+    std::shared_ptr<const MapSnapshot> snapshot = MapSnapshot::getInstalled();
+    long dictionaryBytes = BuildingDictionary::getInstance().getMemoryBytes();
+    long snapshotBytes = snapshot ? snapshot->getBytes() : 0;
+    long limit = budget.load();
+
+    std::ostringstream perSession;
+    SessionMemory sums;
+    long total = dictionaryBytes + snapshotBytes;
+    std::lock_guard<std::mutex> lock(mutex);
+    for(const auto& account: accounts) {
+        const SessionMemory& memory = account.second.memory;
+        perSession << (perSession.tellp() > 0 ? "," : "") << "{\"session\":" << account.first << ",\"total_bytes\":" << memory.getTotal()
+                   << ",\"over_budget\":" << (account.second.overBudget ? "true" : "false") << ",\"structures\":{";
+        for(int structure = 0; structure < SessionMemory::STRUCTURES; structure++) {
+            perSession << (structure > 0 ? "," : "") << "\"" << SessionMemory::NAMES[structure] << "\":" << memory.bytes[structure];
+            sums.bytes[structure] += memory.bytes[structure];
+        }
+        perSession << "}}";
+        total += memory.getTotal();
+    }
+
+    std::ostringstream json;
+    json << "{\"budget_bytes\":" << limit << ",\"total_bytes\":" << total << ",\"sessions\":" << accounts.size() << ",\"structures\":{";
+    for(int structure = 0; structure < SessionMemory::STRUCTURES; structure++) {
+        json << (structure > 0 ? "," : "") << "\"" << SessionMemory::NAMES[structure] << "\":" << sums.bytes[structure];
+    }
+    json << "},\"shared\":{\"building_dictionary\":" << dictionaryBytes << ",\"map_snapshot\":" << snapshotBytes
+         << "},\"per_session\":[" << perSession.str() << "]}";
+    return json.str();
+}
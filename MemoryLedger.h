@@ -0,0 +1,80 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: Memory of every session by the structure holding it, and of the structures the sessions share.
+*/
+
+#ifndef MEMORYLEDGER_H
+#define MEMORYLEDGER_H
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+
+/**
+* The memory of one session in bytes, by the structure holding it. The maps are measured, the widgets
+* are estimated from their sizes, without what Wt allocates inside them.
+*/
+struct SessionMemory {
+    // the board itself and the building maps it holds
+    static const int BOARD = 0;
+    static const int CLASSIC_MAP = 1;
+    static const int CAMPUS_MAP = 2;
+    static const int CUSTOM_MAP = 3;
+    // the table cells and drop containers of the classic board
+    static const int TABLE_CELLS = 4;
+    // the closures of the drag handlers connected to the cells of the classic board
+    static const int CLICK_HANDLERS = 5;
+    static const int CAMPUS_WIDGET = 6;
+    static const int STRUCTURES = 7;
+    static const char* const NAMES[STRUCTURES];
+
+    long bytes[STRUCTURES] = {};
+
+    long getTotal() const;
+    // the bytes of the maps, reported to the metrics as navi_map_bytes
+    long getMapBytes() const;
+    bool operator==(const SessionMemory& other) const;
+};
+
+/**
+* Accounts of the memory of every open session, shared by the whole process. A session opens an account,
+* updates it whenever its memory changes and closes it when it ends. A session over the budget is
+* reported once, until it gets under it again. A budget of 0 reports no session.
+*/
+class MemoryLedger {
+    public:
+        // 4 MB; the maps of a session that searched both built-in maps hold about 0.6 MB, see /admin/memory
+        static const long DEFAULT_BUDGET = 4L << 20;
+
+        static MemoryLedger& getInstance();
+        MemoryLedger(const MemoryLedger&) = delete;
+        MemoryLedger& operator=(const MemoryLedger&) = delete;
+
+        int openSession();
+        bool updateSession(int account, const SessionMemory& memory);
+        void closeSession(int account);
+        void setBudget(long bytes);
+        long getBudget() const;
+        std::string renderJson() const;
+    private:
+        /**
+        * The last memory reported by a session.
+        */
+        struct Account {
+            SessionMemory memory;
+            bool overBudget = false;
+        };
+
+        MemoryLedger() {
+            budget = DEFAULT_BUDGET;
+        }
+
+        mutable std::mutex mutex;
+        std::map<int, Account> accounts;
+        int nextAccount = 1;
+        std::atomic<long> budget;
+};
+
+#endif
@@ -0,0 +1,32 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: Serves the memory of every session by structure, for the administrators of the server.
+*/
+
+#include "MemoryResource.h"
+#include <string>
+#include "AdminToken.h"
+#include "MemoryLedger.h"
+
+MemoryResource::~MemoryResource()
+{
+  beingDeleted();
+}
+
+/**
+ * @brief Writes the memory of every session and of the process as JSON.
+ * @param request, the HTTP request, with the token of the administrators and no parameters.
+ * @param response, the HTTP response the memory is written to.
+*/
+void MemoryResource::handleRequest(const Wt::Http::Request& request, Wt::Http::Response& response)
+{
+  if(!AdminToken::isAuthorized(request)) {
+    AdminToken::sendForbidden(response);
+    return;
+  }
+  std::string body = MemoryLedger::getInstance().renderJson();
+  response.setMimeType("application/json");
+  response.setContentLength(body.size());
+  response.out() << body;
+}
@@ -0,0 +1,28 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: Serves the memory of every session by structure, for the administrators of the server.
+*/
+
+#ifndef MEMORYRESOURCE_H
+#define MEMORYRESOURCE_H
+
+#include <Wt/WResource.h>
+#include <Wt/Http/Request.h>
+#include <Wt/Http/Response.h>
+
+/**
+* Resource mounted at /admin/memory, shared by every session of the server. A GET answers the
+* MemoryLedger as JSON: the budget of a session, the total of the process, the sums by structure,
+* the memory shared by the sessions and the memory of every session by structure. Sessions are
+* numbered by the ledger, their Wt session ids are not shown. A request must carry the token of the
+* administrators, see AdminToken, or it is answered with status 403.
+*/
+class MemoryResource : public Wt::WResource
+{
+public:
+    ~MemoryResource();
+    void handleRequest(const Wt::Http::Request& request, Wt::Http::Response& response) override;
+};
+
+#endif
@@ -0,0 +1,26 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: Serves the search and session counters in the Prometheus text format.
+*/
+
+#include "MetricsResource.h"
+#include "PhaseTracer.h"
+#include "RouteCache.h"
+#include "SearchMetrics.h"
+
+MetricsResource::~MetricsResource()
+{
+  beingDeleted();
+}
+
+/**
+ * @brief Writes the current counters of every thread, summed, the latency of the request phases and the route cache counters.
+ * @param request, the HTTP request; it has no parameters.
+ * @param response, the HTTP response the metrics are written to.
+*/
+void MetricsResource::handleRequest(const Wt::Http::Request& request, Wt::Http::Response& response)
+{
+  response.setMimeType("text/plain; version=0.0.4");
+  response.out() << SearchMetrics::renderPrometheus() << PhaseTracer::renderPrometheus() << RouteCache::getInstance().renderPrometheus();
+}
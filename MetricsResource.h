@@ -0,0 +1,24 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: Serves the search and session counters in the Prometheus text format.
+*/
+
+#ifndef METRICSRESOURCE_H
+#define METRICSRESOURCE_H
+
+#include <Wt/WResource.h>
+#include <Wt/Http/Request.h>
+#include <Wt/Http/Response.h>
+
+/**
+* Resource mounted at /metrics, shared by every session of the server.
+*/
+class MetricsResource : public Wt::WResource
+{
+public:
+    ~MetricsResource();
+    void handleRequest(const Wt::Http::Request& request, Wt::Http::Response& response) override;
+};
+
+#endif
@@ -0,0 +1,282 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: Command line front end of the routing engine, for batch jobs and profiling without Wt.
+*
+* Usage: navi-route [--map classic|campus|file] [--algorithm dijkstra|astar] [--path] [--no-cache] [--overlay file]
+*                   [--snapshot file] [--nearest k | --alternatives k]
+* Reads one query per line from stdin: "startRow startCol targetRow targetCol [algorithm]".
+* Empty lines and lines starting with '#' are skipped. For every query one line is printed:
+* "startRow startCol targetRow targetCol algorithm found cost length expansions pushes pops microseconds",
+* followed by a "path row,col ..." line when --path is given. A summary is printed on stderr at the end.
+* Repeated queries are answered from the route cache unless --no-cache is given.
+* With --nearest k a query may list several targets, "startRow startCol targetRow targetCol ... [algorithm]",
+* and one search finds the k nearest of them: a line is printed for each target found, nearest first, all
+* with the counters of that search, or one line with found 0 for the first target if none can be reached.
+* With --alternatives k the k shortest loopless routes to the target are printed the same way, cheapest first.
+* With --overlay the weights in the file are laid over the map before the first query, one block per line:
+* "row col weight", or "row col closed" for a block that cannot be entered.
+* With --snapshot the graph tables of the built-in maps are mapped from the file, which is written first if it
+* is missing or out of date, see MapSnapshot.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "AlgorithmFactory.h"
+#include "LogicServer.h"
+#include "MapSnapshot.h"
+
+/**
+* Loads the map named on the command line into the board.
+* @param board: the board to load the map into.
+* @param name: classic, campus or the path of a text map.
+* @return true if the map was loaded.
+*/
+static bool loadMap(Board& board, const std::string& name) {
+    if(name == "classic") {
+        board.switchMap(0);
+        return true;
+    }
+    if(name == "campus") {
+        board.switchMap(1);
+        return true;
+    }
+    std::ifstream in(name);
+    if(!in) {
+        std::fprintf(stderr, "navi-route: cannot open map %s\n", name.c_str());
+        return false;
+    }
+    if(!board.loadCustomMap(in)) {
+        std::fprintf(stderr, "navi-route: %s is not a valid map\n", name.c_str());
+        return false;
+    }
+    return true;
+}
+
+/**
+* Checks that a block is on the map and not a wall.
+* @param map: the map.
+* @param row: the row of the block.
+* @param col: the column of the block.
+* @return true if a route can start or end on the block.
+*/
+static bool isWalkable(LevelMap* map, int row, int col) {
+    if(row < 0 || col < 0 || row >= map->getRows() || col >= map->getColumns()) {
+        return false;
+    }
+    return map->getNode(row, col)->getType() != 5;
+}
+
+/**
+* Prints the "path row,col ..." line of a route.
+* @param path: the route.
+*/
+static void printPathLine(const std::vector<std::pair<int, int>>& path) {
+    std::printf("path");
+    for(const auto& block: path) {
+        std::printf(" %d,%d", block.first, block.second);
+    }
+    std::printf("\n");
+}
+
+/**
+* Reads an overlay file and publishes it for the map type of the board.
+* @param board: the board, with its map loaded.
+* @param name: the path of the overlay file.
+* @return true if the overlay was published.
+*/
+static bool loadOverlay(Board& board, const std::string& name) {
+    std::ifstream in(name);
+    if(!in) {
+        std::fprintf(stderr, "navi-route: cannot open overlay %s\n", name.c_str());
+        return false;
+    }
+    std::vector<OverlayChange> changes;
+    std::string line;
+    while(std::getline(in, line)) {
+        if(line.empty() || line[0] == '#') {
+            continue;
+        }
+        std::istringstream fields(line);
+        OverlayChange change;
+        std::string weight;
+        if(!(fields >> change.row >> change.col >> weight)) {
+            std::fprintf(stderr, "navi-route: overlay line \"%s\": expected row col weight\n", line.c_str());
+            return false;
+        }
+        change.weight = weight == "closed" ? GraphView::CLOSED : std::atoi(weight.c_str());
+        if(change.weight < 1 && weight != "closed") {
+            std::fprintf(stderr, "navi-route: overlay line \"%s\": the weight must be positive or closed\n", line.c_str());
+            return false;
+        }
+        changes.push_back(change);
+    }
+    OverlayStore::getInstance().publish(board.getMapType(), std::move(changes));
+    return true;
+}
+
+/**
+* Prints the command line options.
+* @param program: the name the program was run as.
+*/
+static void printUsage(const char* program) {
+    std::fprintf(stderr, "usage: %s [--map classic|campus|file] [--algorithm dijkstra|astar] [--path] [--no-cache] [--overlay file]"
+                 " [--snapshot file] [--nearest k | --alternatives k]\n", program);
+}
+
+int main(int argc, char **argv)
+{
+    std::string mapName = "classic";
+    int defaultType = 0;
+    bool printPath = false;
+    bool useCache = true;
+    int nearest = 0;
+    int alternatives = 0;
+    std::string overlayName;
+    std::string snapshotName;
+    for(int i = 1; i < argc; i++) {
+        if(std::strcmp(argv[i], "--map") == 0 && i + 1 < argc) {
+            mapName = argv[++i];
+        } else if(std::strcmp(argv[i], "--algorithm") == 0 && i + 1 < argc) {
+            defaultType = AlgorithmFactory::findAlgorithmType(argv[++i]);
+            if(defaultType < 0) {
+                std::fprintf(stderr, "navi-route: unknown algorithm %s\n", argv[i]);
+                return 1;
+            }
+        } else if(std::strcmp(argv[i], "--path") == 0) {
+            printPath = true;
+        } else if(std::strcmp(argv[i], "--no-cache") == 0) {
+            useCache = false;
+        } else if(std::strcmp(argv[i], "--overlay") == 0 && i + 1 < argc) {
+            overlayName = argv[++i];
+        } else if(std::strcmp(argv[i], "--snapshot") == 0 && i + 1 < argc) {
+            snapshotName = argv[++i];
+        } else if(std::strcmp(argv[i], "--nearest") == 0 && i + 1 < argc && std::atoi(argv[i + 1]) > 0) {
+            nearest = std::atoi(argv[++i]);
+        } else if(std::strcmp(argv[i], "--alternatives") == 0 && i + 1 < argc && std::atoi(argv[i + 1]) > 0) {
+            alternatives = std::atoi(argv[++i]);
+        } else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    if(nearest > 0 && alternatives > 0) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    if(!snapshotName.empty() && !MapSnapshot::prepare(snapshotName)) {
+        std::fprintf(stderr, "navi-route: cannot read or write the snapshot %s\n", snapshotName.c_str());
+        return 1;
+    }
+    Board board;
+    if(!loadMap(board, mapName)) {
+        return 1;
+    }
+    if(!overlayName.empty() && !loadOverlay(board, overlayName)) {
+        return 1;
+    }
+    LevelMap* map = board.getMap();
+    LogicServer logicServer(&board);
+    logicServer.setCacheEnabled(useCache);
+
+    long queries = 0;
+    long failures = 0;
+    long totalNs = 0;
+    long lineNumber = 0;
+    std::string line;
+    while(std::getline(std::cin, line)) {
+        lineNumber++;
+        if(line.empty() || line[0] == '#') {
+            continue;
+        }
+        std::istringstream fields(line);
+        int startRow, startCol, targetRow, targetCol;
+        if(!(fields >> startRow >> startCol >> targetRow >> targetCol)) {
+            std::fprintf(stderr, "navi-route: line %ld: expected startRow startCol targetRow targetCol\n", lineNumber);
+            failures++;
+            continue;
+        }
+        std::vector<std::pair<int, int>> targets(1, std::make_pair(targetRow, targetCol));
+        int row, col;
+        while(nearest > 0 && fields >> row >> col) {
+            targets.push_back(std::make_pair(row, col));
+        }
+        // the algorithm name stopped the list of targets
+        fields.clear();
+        int type = defaultType;
+        std::string algorithm;
+        if(fields >> algorithm) {
+            type = AlgorithmFactory::findAlgorithmType(algorithm);
+            if(type < 0) {
+                std::fprintf(stderr, "navi-route: line %ld: unknown algorithm %s\n", lineNumber, algorithm.c_str());
+                failures++;
+                continue;
+            }
+        }
+        bool walkable = isWalkable(map, startRow, startCol);
+        for(const std::pair<int, int>& target: targets) {
+            walkable = walkable && isWalkable(map, target.first, target.second);
+        }
+        if(!walkable) {
+            std::fprintf(stderr, "navi-route: line %ld: start or target is off the map or a wall\n", lineNumber);
+            failures++;
+            continue;
+        }
+
+        logicServer.setAlgorithm(type, &board);
+        map->setStartPoint(startRow, startCol);
+        if(nearest > 0 || alternatives > 0) {
+            map->setTargetPoint(targetRow, targetCol);
+            auto start = std::chrono::steady_clock::now();
+            const std::vector<NearestRoute>& routes = nearest > 0 ? logicServer.findNearest(targets, nearest) : logicServer.findAlternatives(alternatives);
+            long elapsedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+            totalNs += elapsedNs;
+            queries++;
+            const SearchStats& stats = logicServer.getLastStats();
+            for(size_t i = 0; i < std::max<size_t>(routes.size(), 1); i++) {
+                const std::pair<int, int>& target = routes.empty() ? targets[0] : targets[routes[i].target];
+                std::printf("%d %d %d %d %s %d %d %zu %ld %ld %ld %.1f\n", startRow, startCol, target.first, target.second,
+                            AlgorithmFactory::getAlgorithmName(type).c_str(), routes.empty() ? 0 : 1, routes.empty() ? 0 : routes[i].cost,
+                            routes.empty() ? 0 : routes[i].path.size(), stats.expansions, stats.heapPushes, stats.heapPops, elapsedNs / 1000.0);
+                if(printPath && !routes.empty()) {
+                    printPathLine(routes[i].path);
+                }
+            }
+            continue;
+        }
+        map->setTargetPoint(targetRow, targetCol);
+        auto start = std::chrono::steady_clock::now();
+        const auto& result = logicServer.runAlgorithm();
+        auto end = std::chrono::steady_clock::now();
+        long elapsedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+        totalNs += elapsedNs;
+        queries++;
+
+        const std::vector<std::pair<int, int>>& path = result.second;
+        // the cost of a route is the weight of every block entered after the start
+        long cost = 0;
+        for(size_t i = 1; i < path.size(); i++) {
+            cost += map->getWeight(path[i].first, path[i].second);
+        }
+        SearchStats stats = logicServer.getLastStats();
+        std::printf("%d %d %d %d %s %d %ld %zu %ld %ld %ld %.1f\n", startRow, startCol, targetRow, targetCol,
+                    AlgorithmFactory::getAlgorithmName(type).c_str(), path.empty() ? 0 : 1, cost, path.size(),
+                    stats.expansions, stats.heapPushes, stats.heapPops, elapsedNs / 1000.0);
+        if(printPath) {
+            printPathLine(path);
+        }
+    }
+
+    std::fprintf(stderr, "navi-route: %ld queries, %ld rejected, %.3f ms searching, %.1f us/query\n", queries, failures,
+                 totalNs / 1e6, queries > 0 ? totalNs / 1e3 / queries : 0.0);
+    return failures > 0 ? 2 : 0;
+}
@@ -0,0 +1,168 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: HTTP API to publish the closed blocks and changed weights of a map, such as the closures of the day.
+*/
+
+#include "OverlayResource.h"
+#include <cstdlib>
+#include <memory>
+#include <sstream>
+#include <utility>
+#include "AdminToken.h"
+#include "BuildingDictionary.h"
+
+OverlayResource::~OverlayResource()
+{
+  beingDeleted();
+}
+
+/**
+ * @brief Returns the built-in map of a type, as it is before any session edits it.
+ * @param mapType, 0 for the classic map, 1 for the campus map.
+ * @return layout, the size of the map and, on the campus, the doors of the buildings, which no request changes.
+*/
+const LevelMap& OverlayResource::getLayout(int mapType)
+{
+  static const LevelMap classic;
+  static const LevelMap campus(1);
+  return mapType == 1 ? campus : classic;
+}
+
+/**
+ * @brief Reads the blocks a request closes: cells as "row,col" or, on the campus map, building names, separated by ';'.
+ * @param text, the parameter value.
+ * @param mapType, 0 for the classic map, 1 for the campus map.
+ * @param changes, a closing change for every block named is added at its end.
+ * @return true if every part of the text names a cell on the map or a building.
+*/
+bool OverlayResource::parseClosed(const std::string& text, int mapType, std::vector<OverlayChange>& changes)
+{
+  const LevelMap& layout = getLayout(mapType);
+  std::istringstream parts(text);
+  std::string part;
+  while(std::getline(parts, part, ';')) {
+    int row, col;
+    char comma;
+    std::istringstream cell(part);
+    if(cell >> row >> comma >> col && comma == ',' && cell.peek() == EOF) {
+      if(row < 0 || col < 0 || row >= layout.getRows() || col >= layout.getColumns()) {
+        return false;
+      }
+      changes.push_back({row, col, GraphView::CLOSED});
+      continue;
+    }
+    const BuildingDictionary& dictionary = BuildingDictionary::getInstance();
+    int id = mapType == 1 ? dictionary.findBuilding(part) : -1;
+    if(id < 0) {
+      return false;
+    }
+    std::vector<std::pair<int, int>> doors;
+    dictionary.appendBuildingCells(id, BuildingDictionary::ENTRANCES, layout, doors);
+    for(const std::pair<int, int>& door: doors) {
+      changes.push_back({door.first, door.second, GraphView::CLOSED});
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Reads the weights a request changes, as "row,col,weight" separated by ';'.
+ * @param text, the parameter value.
+ * @param mapType, 0 for the classic map, 1 for the campus map.
+ * @param changes, a change for every block is added at its end.
+ * @return true if every part of the text is a cell on the map with a weight from 1 to 255.
+*/
+bool OverlayResource::parseWeights(const std::string& text, int mapType, std::vector<OverlayChange>& changes)
+{
+  const LevelMap& layout = getLayout(mapType);
+  std::istringstream parts(text);
+  std::string part;
+  while(std::getline(parts, part, ';')) {
+    int row, col, weight;
+    char first, second;
+    std::istringstream cell(part);
+    if(!(cell >> row >> first >> col >> second >> weight) || first != ',' || second != ',' || cell.peek() != EOF
+       || weight < 1 || weight > 255 || row < 0 || col < 0 || row >= layout.getRows() || col >= layout.getColumns()) {
+      return false;
+    }
+    changes.push_back({row, col, weight});
+  }
+  return true;
+}
+
+/**
+ * @brief Answers a request that cannot be carried out.
+ * @param response, the HTTP response.
+ * @param message, what is wrong with the request.
+*/
+void OverlayResource::sendError(Wt::Http::Response& response, const std::string& message)
+{
+  std::string body = "{\"error\":\"" + message + "\"}";
+  response.setStatus(400);
+  response.setMimeType("application/json");
+  response.setContentLength(body.size());
+  response.out() << body;
+}
+
+/**
+ * @brief Answers the overlay of a map, after publishing a new one for a POST.
+ * @param request, the HTTP request with the parameters described in OverlayResource.h.
+ * @param response, the HTTP response the overlay is written to.
+*/
+void OverlayResource::handleRequest(const Wt::Http::Request& request, Wt::Http::Response& response)
+{
+  const std::string* mapText = request.getParameter("map");
+  std::string mapName = mapText ? *mapText : "campus";
+  int mapType;
+  if(mapName == "campus") {
+    mapType = 1;
+  } else if(mapName == "classic") {
+    mapType = 0;
+  } else {
+    sendError(response, "unknown map");
+    return;
+  }
+
+  OverlayStore& store = OverlayStore::getInstance();
+  std::shared_ptr<const WeightOverlay> overlay;
+  if(request.method() == "POST") {
+    if(!AdminToken::isAuthorized(request)) {
+      AdminToken::sendForbidden(response);
+      return;
+    }
+    std::vector<OverlayChange> changes;
+    const std::string* closed = request.getParameter("closed");
+    const std::string* weights = request.getParameter("weights");
+    if(closed && !parseClosed(*closed, mapType, changes)) {
+      sendError(response, "closed must be row,col on the map or a building name");
+      return;
+    }
+    if(weights && !parseWeights(*weights, mapType, changes)) {
+      sendError(response, "weights must be row,col,weight on the map with a weight from 1 to 255");
+      return;
+    }
+    overlay = store.publish(mapType, std::move(changes));
+  } else {
+    overlay = store.getOverlay(mapType);
+  }
+
+  std::ostringstream closedJson;
+  std::ostringstream weightsJson;
+  if(overlay) {
+    for(const OverlayChange& change: overlay->changes) {
+      if(change.weight == GraphView::CLOSED) {
+        closedJson << (closedJson.tellp() > 0 ? "," : "") << change.row << "," << change.col;
+      } else {
+        weightsJson << (weightsJson.tellp() > 0 ? "," : "") << change.row << "," << change.col << "," << change.weight;
+      }
+    }
+  }
+  std::ostringstream json;
+  json << "{\"map\":\"" << mapName << "\",\"version\":" << (overlay ? overlay->version : 0) << ",\"closed\":[" << closedJson.str()
+       << "],\"weights\":[" << weightsJson.str() << "]}";
+  std::string body = json.str();
+  response.setMimeType("application/json");
+  response.setContentLength(body.size());
+  response.out() << body;
+}
@@ -0,0 +1,47 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: HTTP API to publish the closed blocks and changed weights of a map, such as the closures of the day.
+*/
+
+#ifndef OVERLAYRESOURCE_H
+#define OVERLAYRESOURCE_H
+
+#include <Wt/WResource.h>
+#include <Wt/Http/Request.h>
+#include <Wt/Http/Response.h>
+#include <string>
+#include <vector>
+#include "LevelMap.h"
+#include "WeightOverlay.h"
+
+/**
+* Resource mounted at /api/overlay, shared by every client of the server. A GET answers the current
+* overlay of a map, a POST replaces it with a new version, which every search started afterwards uses.
+* A POST must carry the token of the administrators, see AdminToken, or it is answered with status 403.
+*
+* Parameters, as query string or form data:
+*   map:        campus (default) or classic
+*   closed:     blocks that cannot be entered, as "row,col", or on the campus map building names of the
+*               BuildingDictionary, which close every door of the building, separated by ';'
+*   weights:    blocks with a new weight from 1 to 255, as "row,col,weight" separated by ';'
+* Every row and column must be on the map.
+*
+* A POST without closed and weights takes every change back. The answer is
+* {"map":"campus","version":v,"closed":[row,col,...],"weights":[row,col,weight,...]}, with version 0 while
+* nothing was published for the map. Errors are answered with status 400 and {"error":"..."}.
+*/
+class OverlayResource : public Wt::WResource
+{
+public:
+    ~OverlayResource();
+    void handleRequest(const Wt::Http::Request& request, Wt::Http::Response& response) override;
+
+private:
+    static const LevelMap& getLayout(int mapType);
+    static bool parseClosed(const std::string& text, int mapType, std::vector<OverlayChange>& changes);
+    static bool parseWeights(const std::string& text, int mapType, std::vector<OverlayChange>& changes);
+    static void sendError(Wt::Http::Response& response, const std::string& message);
+};
+
+#endif
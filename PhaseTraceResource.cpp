@@ -0,0 +1,37 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: Serves the phase trace of one session as Chrome trace event JSON.
+*/
+
+#include "PhaseTraceResource.h"
+#include <utility>
+
+/**
+ * @brief This constructor binds the resource to the trace of a session.
+ * @param recorder, the trace of the session, shared with it since Wt destroys the link to the resource,
+ * and may still serve a download, after the session itself is gone.
+*/
+PhaseTraceResource::PhaseTraceResource(std::shared_ptr<const TraceRecorder> recorder)
+ : recorder_(std::move(recorder))
+{
+  // the recorder is written while the session handles events, so read it under the session lock
+  setTakesUpdateLock(true);
+  suggestFileName("navi-trace.json");
+}
+
+PhaseTraceResource::~PhaseTraceResource()
+{
+  beingDeleted();
+}
+
+/**
+ * @brief Writes every span recorded so far, to be loaded in chrome://tracing or Perfetto.
+ * @param request, the HTTP request; it has no parameters.
+ * @param response, the HTTP response the trace is written to.
+*/
+void PhaseTraceResource::handleRequest(const Wt::Http::Request& request, Wt::Http::Response& response)
+{
+  response.setMimeType("application/json");
+  response.out() << recorder_->toChromeJson();
+}
@@ -0,0 +1,30 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: Serves the phase trace of one session as Chrome trace event JSON.
+*/
+
+#ifndef PHASETRACERESOURCE_H
+#define PHASETRACERESOURCE_H
+
+#include <Wt/WResource.h>
+#include <Wt/Http/Request.h>
+#include <Wt/Http/Response.h>
+#include <memory>
+#include "PhaseTracer.h"
+
+/**
+* Resource private to a traced session, linked from its page.
+*/
+class PhaseTraceResource : public Wt::WResource
+{
+public:
+    PhaseTraceResource(std::shared_ptr<const TraceRecorder> recorder);
+    ~PhaseTraceResource();
+    void handleRequest(const Wt::Http::Request& request, Wt::Http::Response& response) override;
+
+private:
+    std::shared_ptr<const TraceRecorder> recorder_;
+};
+
+#endif
@@ -0,0 +1,267 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: Scoped spans timing the phases of a request, latency histograms and Chrome trace recording.
+*/
+
+#include "PhaseTracer.h"
+#include <atomic>
+#include <mutex>
+#include <sstream>
+
+namespace {
+    // number of map types: 0 classic, 1 campus, 2 custom
+    const int MAP_TYPES = 3;
+    // every power of two is split into 8 buckets, so a bucket is at most 12.5% wide; the last bucket holds
+    // everything from about 68 seconds up
+    const int SUB_BUCKETS = 8;
+    const int BUCKETS = 35 * SUB_BUCKETS;
+
+    const char* PHASE_NAMES[PHASE_COUNT] = {"request", "wt", "visualize", "search", "result", "paint"};
+    const char* MAP_NAMES[MAP_TYPES] = {"classic", "campus", "custom"};
+
+    /**
+    * Histograms written by a single thread, the same way as the search metrics shards.
+    */
+    struct HistogramShard {
+        std::atomic<long> buckets[PHASE_COUNT][MAP_TYPES][BUCKETS];
+        std::atomic<long> count[PHASE_COUNT][MAP_TYPES];
+        std::atomic<long> sumNs[PHASE_COUNT][MAP_TYPES];
+    };
+
+    std::mutex shardsMutex;
+    std::vector<HistogramShard*> shards;
+    std::atomic<long> nextThreadId(1);
+
+    thread_local TraceSpan* openSpan = nullptr;
+    thread_local TraceRecorder* currentRecorder = nullptr;
+
+    /**
+    * Returns the histograms of the calling thread, creating them on first use.
+    * @return shard: the histograms of the calling thread.
+    */
+    HistogramShard& localShard() {
+        thread_local HistogramShard* shard = nullptr;
+        if(!shard) {
+            shard = new HistogramShard();
+            std::lock_guard<std::mutex> lock(shardsMutex);
+            shards.push_back(shard);
+        }
+        return *shard;
+    }
+
+    /**
+    * Returns a small number naming the calling thread in traces.
+    * @return id: the thread number.
+    */
+    long localThreadId() {
+        thread_local long id = nextThreadId.fetch_add(1);
+        return id;
+    }
+
+    /**
+    * Nanoseconds of a steady clock time point.
+    * @param time: the time point.
+    * @return ns: the nanoseconds since the clock's epoch.
+    */
+    long toNs(std::chrono::steady_clock::time_point time) {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+    }
+
+    /**
+    * Bucket of a duration: exact below 8ns, then 8 buckets per power of two.
+    * @param ns: the duration.
+    * @return index: the bucket.
+    */
+    int bucketOf(long ns) {
+        if(ns < SUB_BUCKETS) {
+            return ns < 0 ? 0 : ns;
+        }
+        int exponent = 63 - __builtin_clzl(ns);
+        int index = (exponent - 2) * SUB_BUCKETS + ((ns >> (exponent - 3)) & (SUB_BUCKETS - 1));
+        return index < BUCKETS ? index : BUCKETS - 1;
+    }
+
+    /**
+    * Middle of a bucket, the value reported for every duration in it.
+    * @param index: the bucket.
+    * @return ns: the middle of the bucket.
+    */
+    double bucketMiddle(int index) {
+        if(index < SUB_BUCKETS) {
+            return index;
+        }
+        int exponent = index / SUB_BUCKETS + 2;
+        double width = (double) (1L << (exponent - 3));
+        return (SUB_BUCKETS + index % SUB_BUCKETS) * width + width / 2;
+    }
+}
+
+/**
+* Adds a finished span to the trace.
+* @param phase: the phase of the span.
+* @param mapType: the map type of the board.
+* @param startNs: the start of the span on the steady clock.
+* @param durationNs: the length of the span.
+*/
+void TraceRecorder::add(TracePhase phase, int mapType, long startNs, long durationNs) {
+    if(events.size() < MAX_EVENTS) {
+        events.push_back({phase, mapType, startNs, durationNs, localThreadId()});
+    }
+}
+
+/**
+* Writes the recorded spans as Chrome trace events, which about:tracing and Perfetto can load.
+* @return json: the trace.
+*/
+std::string TraceRecorder::toChromeJson() const {
+    std::ostringstream out;
+    out.setf(std::ios::fixed);
+    out.precision(3);
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    for(size_t i = 0; i < events.size(); i++) {
+        const Event& event = events[i];
+        out << (i > 0 ? ",\n" : "\n") << "{\"name\":\"" << PHASE_NAMES[event.phase] << "\",\"cat\":\""
+            << (event.mapType >= 0 && event.mapType < MAP_TYPES ? MAP_NAMES[event.mapType] : "none")
+            << "\",\"ph\":\"X\",\"ts\":" << event.startNs / 1000.0 << ",\"dur\":" << event.durationNs / 1000.0
+            << ",\"pid\":1,\"tid\":" << event.threadId << "}";
+    }
+    out << "\n]}\n";
+    return out.str();
+}
+
+/**
+* Opens a span on the calling thread.
+* @param phase: the phase timed by the span.
+* @param mapType: the map type of the board, used as a label of the histograms.
+* @param recorder: if given, the trace receiving this span and the spans inside it.
+*/
+TraceSpan::TraceSpan(TracePhase phase, int mapType, TraceRecorder* recorder) {
+    this->phase = phase;
+    this->mapType = mapType;
+    childNs = 0;
+    parent_ = openSpan;
+    previousRecorder_ = currentRecorder;
+    installsRecorder = recorder != nullptr;
+    if(installsRecorder) {
+        currentRecorder = recorder;
+    }
+    openSpan = this;
+    start = std::chrono::steady_clock::now();
+}
+
+/**
+* Closes the span: adds it to the histograms, to its parent and to the trace.
+*/
+TraceSpan::~TraceSpan() {
+    long durationNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    PhaseTracer::record(phase, mapType, durationNs);
+    if(phase == PHASE_REQUEST) {
+        PhaseTracer::record(PHASE_WT, mapType, durationNs - childNs);
+    }
+    if(parent_) {
+        parent_->childNs += durationNs;
+    }
+    if(currentRecorder) {
+        currentRecorder->add(phase, mapType, toNs(start), durationNs);
+    }
+    openSpan = parent_;
+    if(installsRecorder) {
+        currentRecorder = previousRecorder_;
+    }
+}
+
+/**
+* Adds a duration to the histogram of a phase and map type.
+* @param phase: the phase.
+* @param mapType: the map type, durations with an unknown map type are dropped.
+* @param durationNs: the duration.
+*/
+void PhaseTracer::record(TracePhase phase, int mapType, long durationNs) {
+    if(mapType < 0 || mapType >= MAP_TYPES) {
+        return;
+    }
+    HistogramShard& shard = localShard();
+    std::atomic<long>& bucket = shard.buckets[phase][mapType][bucketOf(durationNs)];
+    bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    shard.count[phase][mapType].store(shard.count[phase][mapType].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    shard.sumNs[phase][mapType].store(shard.sumNs[phase][mapType].load(std::memory_order_relaxed) + durationNs, std::memory_order_relaxed);
+}
+
+/**
+* Estimates a quantile of a phase from the histograms of all threads.
+* @param phase: the phase.
+* @param mapType: the map type.
+* @param quantile: the quantile, between 0 and 1.
+* @return seconds: the estimated duration, 0 if the phase was never recorded.
+*/
+double PhaseTracer::quantileSeconds(TracePhase phase, int mapType, double quantile) {
+    std::vector<long> buckets(BUCKETS, 0);
+    long total = 0;
+    {
+        std::lock_guard<std::mutex> lock(shardsMutex);
+        for(HistogramShard* shard: shards) {
+            for(int i = 0; i < BUCKETS; i++) {
+                long n = shard->buckets[phase][mapType][i].load(std::memory_order_relaxed);
+                buckets[i] += n;
+                total += n;
+            }
+        }
+    }
+    if(total == 0) {
+        return 0;
+    }
+    long rank = (long) (quantile * total);
+    long seen = 0;
+    for(int i = 0; i < BUCKETS; i++) {
+        seen += buckets[i];
+        if(seen > rank) {
+            return bucketMiddle(i) / 1e9;
+        }
+    }
+    return bucketMiddle(BUCKETS - 1) / 1e9;
+}
+
+/**
+* Writes the p50, p95 and p99 of every phase and map type that was recorded, in the Prometheus text format.
+* @return text: the summaries.
+*/
+std::string PhaseTracer::renderPrometheus() {
+    std::ostringstream out;
+    out << "# HELP navi_phase_seconds Latency of the phases of a request; wt is the time of a request outside its other phases.\n";
+    out << "# TYPE navi_phase_seconds summary\n";
+    const double quantiles[] = {0.5, 0.95, 0.99};
+    for(int phase = 0; phase < PHASE_COUNT; phase++) {
+        for(int map = 0; map < MAP_TYPES; map++) {
+            long count = 0;
+            long sumNs = 0;
+            {
+                std::lock_guard<std::mutex> lock(shardsMutex);
+                for(HistogramShard* shard: shards) {
+                    count += shard->count[phase][map].load(std::memory_order_relaxed);
+                    sumNs += shard->sumNs[phase][map].load(std::memory_order_relaxed);
+                }
+            }
+            if(count == 0) {
+                continue;
+            }
+            std::string labels = std::string("phase=\"") + PHASE_NAMES[phase] + "\",map=\"" + MAP_NAMES[map] + "\"";
+            for(double quantile: quantiles) {
+                out << "navi_phase_seconds{" << labels << ",quantile=\"" << quantile << "\"} "
+                    << quantileSeconds((TracePhase) phase, map, quantile) << "\n";
+            }
+            out << "navi_phase_seconds_sum{" << labels << "} " << sumNs / 1e9 << "\n";
+            out << "navi_phase_seconds_count{" << labels << "} " << count << "\n";
+        }
+    }
+    return out.str();
+}
+
+/**
+* Name of a phase, as used in the metrics and traces.
+* @param phase: the phase.
+* @return name: the short name of the phase.
+*/
+const char* PhaseTracer::getPhaseName(TracePhase phase) {
+    return PHASE_NAMES[phase];
+}
@@ -0,0 +1,83 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: Scoped spans timing the phases of a request, latency histograms and Chrome trace recording.
+*/
+
+#ifndef PHASETRACER_H
+#define PHASETRACER_H
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+/**
+* The phases a request is split into. PHASE_WT is not opened by a span: it is the part of a request
+* that none of its child spans cover, which is Wt dispatching the event and serializing the response.
+*/
+enum TracePhase {
+    PHASE_REQUEST,
+    PHASE_WT,
+    PHASE_VISUALIZE,
+    PHASE_SEARCH,
+    PHASE_RESULT,
+    PHASE_PAINT,
+    PHASE_COUNT
+};
+
+/**
+* The spans of one session in the Chrome trace event format, filled while the session is traced.
+* A session is only handled by one thread at a time, so the recorder needs no lock.
+*/
+class TraceRecorder {
+    public:
+        void add(TracePhase phase, int mapType, long startNs, long durationNs);
+        std::string toChromeJson() const;
+    private:
+        // events beyond this are dropped, which keeps a long traced session from growing without bound
+        static const size_t MAX_EVENTS = 100000;
+
+        struct Event {
+            TracePhase phase;
+            int mapType;
+            long startNs;
+            long durationNs;
+            long threadId;
+        };
+        std::vector<Event> events;
+};
+
+/**
+* Times a phase from construction to destruction and adds it to the histogram of the phase and map type.
+* Spans nest per thread. The outermost span of a request may install a recorder, which then receives
+* this span and every span opened inside it on the same thread.
+*/
+class TraceSpan {
+    public:
+        TraceSpan(TracePhase phase, int mapType, TraceRecorder* recorder = nullptr);
+        ~TraceSpan();
+        TraceSpan(const TraceSpan&) = delete;
+        TraceSpan& operator=(const TraceSpan&) = delete;
+    private:
+        TracePhase phase;
+        int mapType;
+        std::chrono::steady_clock::time_point start;
+        // time spent in spans opened inside this one
+        long childNs;
+        TraceSpan* parent_;
+        TraceRecorder* previousRecorder_;
+        bool installsRecorder;
+};
+
+/**
+* Latency histograms of all threads, by phase and map type.
+*/
+class PhaseTracer {
+    public:
+        static void record(TracePhase phase, int mapType, long durationNs);
+        static double quantileSeconds(TracePhase phase, int mapType, double quantile);
+        static std::string renderPrometheus();
+        static const char* getPhaseName(TracePhase phase);
+};
+
+#endif
@@ -0,0 +1,338 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: Process wide cache of search results, shared by every session and thread.
+*/
+
+#include "RouteCache.h"
+#include <algorithm>
+#include <sstream>
+
+/**
+* Mixes every field of the key.
+* @param key: the key.
+* @return hash: the hash of the key.
+*/
+size_t RouteKeyHash::operator()(const RouteKey& key) const {
+    unsigned long long hash = key.mapVersion;
+    const int fields[] = {key.startRow, key.startCol, key.targetRow, key.targetCol, key.algorithmType};
+    for(int field: fields) {
+        hash = (hash ^ (unsigned int) field) * 0x100000001b3ULL;
+        hash ^= hash >> 29;
+    }
+    // the sets are told apart by their sizes as well, so moving a block from one to the other changes the hash
+    for(const std::vector<int>* cells: {&key.startCells, &key.targetCells}) {
+        hash = (hash ^ cells->size()) * 0x100000001b3ULL;
+        for(int cell: *cells) {
+            hash = (hash ^ (unsigned int) cell) * 0x100000001b3ULL;
+            hash ^= hash >> 29;
+        }
+    }
+    return hash;
+}
+
+/**
+* Returns the memory of the sets of blocks of a key, held twice by the cache: in the list and in the index.
+* @return bytes: the memory counted for the key on top of its entry, 0 for a search between two blocks.
+*/
+long RouteKey::getBytes() const {
+    return 2 * (startCells.size() + targetCells.size()) * sizeof(int);
+}
+
+/**
+* Checks whether the search of the entry expanded a block.
+* @param row: the row of the block.
+* @param col: the column of the block.
+* @return true if the block is one of the touched cells.
+*/
+bool RouteEntry::touches(int row, int col) const {
+    return std::binary_search(touchedCells.begin(), touchedCells.end(), row * columns + col);
+}
+
+/**
+* Returns the cache of the process, created on first use.
+* @return cache: the cache.
+*/
+RouteCache& RouteCache::getInstance() {
+    static RouteCache cache;
+    return cache;
+}
+
+/**
+* Builds an entry from a finished search.
+* @param result: the visited blocks and the path returned by the search.
+* @param stats: the counters of the search.
+* @param columns: the number of columns of the map.
+* @return entry: the entry, ready to be inserted.
+*/
+std::shared_ptr<const RouteEntry> RouteCache::makeEntry(const std::pair<std::vector<std::pair<int, int>>, std::vector<std::pair<int, int>>>& result,
+                                                        const SearchStats& stats, int columns) {
+    std::shared_ptr<RouteEntry> entry = std::make_shared<RouteEntry>();
+    entry->result = result;
+    entry->stats = stats;
+    entry->columns = columns;
+    entry->touchedCells.reserve(result.first.size() + result.second.size());
+    for(const std::pair<int, int>& cell: result.first) {
+        entry->touchedCells.push_back(cell.first * columns + cell.second);
+    }
+    // a failed search may not have expanded every block of its empty path, so the path is added as well
+    for(const std::pair<int, int>& cell: result.second) {
+        entry->touchedCells.push_back(cell.first * columns + cell.second);
+    }
+    std::sort(entry->touchedCells.begin(), entry->touchedCells.end());
+    entry->touchedCells.erase(std::unique(entry->touchedCells.begin(), entry->touchedCells.end()), entry->touchedCells.end());
+    entry->touchedCells.shrink_to_fit();
+    // the list node, the index node and the shared control block come on top of the vectors
+    entry->bytes = sizeof(RouteEntry) + 96 + (result.first.capacity() + result.second.capacity()) * sizeof(std::pair<int, int>)
+        + entry->touchedCells.capacity() * sizeof(int);
+    return entry;
+}
+
+/**
+* Picks the shard of a key.
+* @param key: the key.
+* @return shard: the shard holding the key.
+*/
+RouteCache::Shard& RouteCache::shardOf(const RouteKey& key) {
+    return shards[RouteKeyHash()(key) % SHARDS];
+}
+
+/**
+* Looks up a search, or joins the thread that is already running it. When neither is possible the caller
+* becomes the one running it: flight is set and the caller must pass its entry to finish, also when the
+* search failed, since other threads may be waiting for it.
+* @param key: the search.
+* @param flight: set to the new flight when the caller has to run the search, nullptr otherwise.
+* @return entry: the cached or shared result, nullptr if the caller has to run the search.
+*/
+std::shared_ptr<const RouteEntry> RouteCache::findOrLead(const RouteKey& key, std::shared_ptr<Flight>& flight) {
+    flight = nullptr;
+    Shard& shard = shardOf(key);
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto found = shard.index.find(key);
+        if(found != shard.index.end()) {
+            shard.hits++;
+            shard.entries.splice(shard.entries.begin(), shard.entries, found->second);
+            return found->second->second;
+        }
+    }
+    // looked up without the lock of the shard, since the entries of older versions are in other shards
+    std::shared_ptr<const RouteEntry> before = findBeforeEdits(key);
+    if(before) {
+        return before;
+    }
+    std::shared_future<std::shared_ptr<const RouteEntry>> result;
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto found = shard.index.find(key);
+        if(found != shard.index.end()) {
+            shard.hits++;
+            shard.entries.splice(shard.entries.begin(), shard.entries, found->second);
+            return found->second->second;
+        }
+        auto running = shard.flights.find(key);
+        if(running == shard.flights.end()) {
+            shard.misses++;
+            flight = std::make_shared<Flight>();
+            shard.flights[key] = flight;
+            return nullptr;
+        }
+        shard.coalesced++;
+        result = running->second->result;
+    }
+    // waited for without the lock, which the running thread takes again to finish; nullptr if its search
+    // failed, the caller then runs the search without a flight
+    return result.get();
+}
+
+/**
+* Ends a flight started by findOrLead: caches the entry and hands it to the threads waiting for it.
+* @param key: the search.
+* @param flight: the flight returned by findOrLead.
+* @param entry: the result, nullptr if the search failed and the waiting threads should run it themselves.
+*/
+void RouteCache::finish(const RouteKey& key, const std::shared_ptr<Flight>& flight, const std::shared_ptr<const RouteEntry>& entry) {
+    // cached before the flight is removed, so a thread asking in between cannot start the search again
+    if(entry) {
+        insert(key, entry);
+    }
+    {
+        Shard& shard = shardOf(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.flights.erase(key);
+    }
+    flight->promise.set_value(entry);
+}
+
+/**
+* Adds a search, evicting the least recently used entries of its shard if it is over capacity.
+* @param key: the search.
+* @param entry: the result.
+*/
+void RouteCache::insert(const RouteKey& key, const std::shared_ptr<const RouteEntry>& entry) {
+    Shard& shard = shardOf(key);
+    if(entry->bytes + key.getBytes() > capacity / SHARDS) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto found = shard.index.find(key);
+    if(found != shard.index.end()) {
+        shard.bytes -= found->second->second->bytes + found->first.getBytes();
+        shard.entries.erase(found->second);
+        shard.index.erase(found);
+    }
+    shard.entries.emplace_front(key, entry);
+    shard.index[key] = shard.entries.begin();
+    shard.bytes += entry->bytes + key.getBytes();
+    evict(shard);
+}
+
+/**
+* Drops the least recently used entries until the shard fits its part of the capacity.
+* @param shard: the shard, locked by the caller.
+*/
+void RouteCache::evict(Shard& shard) {
+    long limit = capacity / SHARDS;
+    while(shard.bytes > limit && !shard.entries.empty()) {
+        shard.bytes -= shard.entries.back().second->bytes + shard.entries.back().first.getBytes();
+        shard.index.erase(shard.entries.back().first);
+        shard.entries.pop_back();
+        shard.evictions++;
+    }
+}
+
+/**
+* Called after a block of a map got more expensive, for example when it became a wall. Only the edit is
+* recorded, the entries are checked against it when they are looked up, see findBeforeEdits. The oldest
+* edits are forgotten once EDITS are recorded.
+* @param oldVersion: the version of the map before the edit.
+* @param newVersion: the version of the map after the edit.
+* @param row: the row of the edited block.
+* @param col: the column of the edited block.
+*/
+void RouteCache::blockCostIncreased(unsigned long long oldVersion, unsigned long long newVersion, int row, int col) {
+    if(oldVersion == newVersion) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(editsMutex);
+    if(edits.find(newVersion) == edits.end()) {
+        editOrder.push_back(newVersion);
+    }
+    edits[newVersion] = {oldVersion, row, col};
+    while(editOrder.size() > EDITS) {
+        edits.erase(editOrder.front());
+        editOrder.pop_front();
+    }
+}
+
+/**
+* Looks up a search on the maps the map of the key was edited from, newest first. A route that does not touch
+* the blocks edited since keeps its cost while every other route can only get longer, so it is still the best
+* one, and its visited blocks are still not walls. The nearest cached version decides: if its entry touched
+* an edited block it is not used. The entry is shared with the older version, not copied, so it is counted
+* once against the capacity.
+* @param key: the search on the edited map.
+* @return entry: the entry of an older version that is still right, nullptr if there is none.
+*/
+std::shared_ptr<const RouteEntry> RouteCache::findBeforeEdits(const RouteKey& key) {
+    std::vector<Edit> chain;
+    {
+        std::lock_guard<std::mutex> lock(editsMutex);
+        unsigned long long version = key.mapVersion;
+        for(auto found = edits.find(version); found != edits.end() && chain.size() < (size_t) EDIT_DEPTH; found = edits.find(version)) {
+            chain.push_back(found->second);
+            version = found->second.parent;
+        }
+    }
+    RouteKey older = key;
+    for(size_t depth = 0; depth < chain.size(); depth++) {
+        older.mapVersion = chain[depth].parent;
+        Shard& shard = shardOf(older);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto found = shard.index.find(older);
+        if(found == shard.index.end()) {
+            continue;
+        }
+        const RouteEntry& entry = *found->second->second;
+        for(size_t edit = 0; edit <= depth; edit++) {
+            if(entry.touches(chain[edit].row, chain[edit].col)) {
+                shard.invalidations++;
+                return nullptr;
+            }
+        }
+        shard.carried++;
+        shard.entries.splice(shard.entries.begin(), shard.entries, found->second);
+        return found->second->second;
+    }
+    return nullptr;
+}
+
+/**
+* Changes the memory the cache may use, evicting entries if it shrinks.
+* @param bytes: the capacity of all shards together.
+*/
+void RouteCache::setCapacity(long bytes) {
+    capacity = bytes;
+    for(Shard& shard: shards) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        evict(shard);
+    }
+}
+
+/**
+* Drops every entry.
+*/
+void RouteCache::clear() {
+    for(Shard& shard: shards) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.entries.clear();
+        shard.index.clear();
+        shard.bytes = 0;
+    }
+    std::lock_guard<std::mutex> lock(editsMutex);
+    edits.clear();
+    editOrder.clear();
+}
+
+/**
+* Writes the counters of the cache in the Prometheus text format.
+* @return text: the metrics of the cache.
+*/
+std::string RouteCache::renderPrometheus() {
+    long hits = 0, misses = 0, coalesced = 0, evictions = 0, invalidations = 0, carried = 0, entries = 0, bytes = 0;
+    for(Shard& shard: shards) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        hits += shard.hits;
+        misses += shard.misses;
+        coalesced += shard.coalesced;
+        evictions += shard.evictions;
+        invalidations += shard.invalidations;
+        carried += shard.carried;
+        entries += shard.index.size();
+        bytes += shard.bytes;
+    }
+    std::ostringstream out;
+    const struct {
+        const char* name;
+        const char* type;
+        const char* help;
+        long value;
+    } metrics[] = {
+        {"navi_route_cache_hits_total", "counter", "Searches answered from the route cache.", hits},
+        {"navi_route_cache_misses_total", "counter", "Searches not found in the route cache.", misses},
+        {"navi_route_cache_coalesced_total", "counter", "Searches that waited for the same search running on another thread.", coalesced},
+        {"navi_route_cache_evictions_total", "counter", "Entries dropped to stay within the capacity.", evictions},
+        {"navi_route_cache_invalidations_total", "counter", "Searches on an edited map not answered by the entry before the edits because it touched an edited block.", invalidations},
+        {"navi_route_cache_carried_total", "counter", "Searches on an edited map answered by the entry before the edits.", carried},
+        {"navi_route_cache_entries", "gauge", "Entries in the route cache.", entries},
+        {"navi_route_cache_bytes", "gauge", "Bytes held by the route cache.", bytes},
+        {"navi_route_cache_capacity_bytes", "gauge", "Bytes the route cache may hold.", capacity.load()},
+    };
+    for(const auto& metric: metrics) {
+        out << "# HELP " << metric.name << " " << metric.help << "\n";
+        out << "# TYPE " << metric.name << " " << metric.type << "\n";
+        out << metric.name << " " << metric.value << "\n";
+    }
+    return out.str();
+}
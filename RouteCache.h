@@ -0,0 +1,146 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: Process wide cache of search results, shared by every session and thread.
+*/
+
+#ifndef ROUTECACHE_H
+#define ROUTECACHE_H
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "Algorithm.h"
+
+/**
+* What a search depends on: the content of the map, the start, the target and the algorithm. A search between
+* sets of blocks, such as the doors of two buildings, has no single start and target, -1, and keeps the blocks
+* of both sets instead, as row * columns + column, sorted and without duplicates.
+*/
+struct RouteKey {
+    unsigned long long mapVersion;
+    int startRow;
+    int startCol;
+    int targetRow;
+    int targetCol;
+    int algorithmType;
+    std::vector<int> startCells;
+    std::vector<int> targetCells;
+
+    bool operator==(const RouteKey& other) const {
+        return mapVersion == other.mapVersion && startRow == other.startRow && startCol == other.startCol
+            && targetRow == other.targetRow && targetCol == other.targetCol && algorithmType == other.algorithmType
+            && startCells == other.startCells && targetCells == other.targetCells;
+    }
+    long getBytes() const;
+};
+
+struct RouteKeyHash {
+    size_t operator()(const RouteKey& key) const;
+};
+
+/**
+* A cached search, never changed after it is made, so it is shared between threads without copying.
+*/
+struct RouteEntry {
+    std::pair<std::vector<std::pair<int, int>>, std::vector<std::pair<int, int>>> result;
+    SearchStats stats;
+    // the cells the search expanded, which include the path, as row * columns + column, sorted
+    std::vector<int> touchedCells;
+    int columns;
+    // memory of the entry, counted against the capacity of the cache
+    long bytes;
+
+    bool touches(int row, int col) const;
+};
+
+/**
+* Least recently used cache of search results, split into shards that each have their own lock.
+* Entries are keyed by the content version of the map, so an entry stays correct for every board with
+* the same walls and weights. When a block of a map gets more expensive only the edit is recorded. A search
+* that is not cached for the edited map is answered by the entry of the map before the edits if that entry
+* touched none of the edited blocks, since it is still the best route.
+* A search that is not cached yet is run by one thread only: threads asking for the same key while it
+* runs wait for its entry instead of searching again.
+*/
+class RouteCache {
+    public:
+        static RouteCache& getInstance();
+        RouteCache(const RouteCache&) = delete;
+        RouteCache& operator=(const RouteCache&) = delete;
+
+        static std::shared_ptr<const RouteEntry> makeEntry(const std::pair<std::vector<std::pair<int, int>>, std::vector<std::pair<int, int>>>& result,
+                                                           const SearchStats& stats, int columns);
+        /**
+        * A search that one thread is running and other threads are waiting for.
+        */
+        struct Flight {
+            std::promise<std::shared_ptr<const RouteEntry>> promise;
+            std::shared_future<std::shared_ptr<const RouteEntry>> result = promise.get_future().share();
+        };
+
+        std::shared_ptr<const RouteEntry> findOrLead(const RouteKey& key, std::shared_ptr<Flight>& flight);
+        void finish(const RouteKey& key, const std::shared_ptr<Flight>& flight, const std::shared_ptr<const RouteEntry>& entry);
+        void insert(const RouteKey& key, const std::shared_ptr<const RouteEntry>& entry);
+        void blockCostIncreased(unsigned long long oldVersion, unsigned long long newVersion, int row, int col);
+        void setCapacity(long bytes);
+        void clear();
+        std::string renderPrometheus();
+    private:
+        static const int SHARDS = 16;
+        // 64 MB for all shards together
+        static const long DEFAULT_CAPACITY = 64L << 20;
+        // edits remembered for all maps together, and how many edits back a lookup goes
+        static const size_t EDITS = 4096;
+        static const int EDIT_DEPTH = 64;
+
+        /**
+        * A block that got more expensive, turning the map of version parent into another version.
+        */
+        struct Edit {
+            unsigned long long parent;
+            int row;
+            int col;
+        };
+
+        typedef std::list<std::pair<RouteKey, std::shared_ptr<const RouteEntry>>> EntryList;
+
+        struct Shard {
+            std::mutex mutex;
+            // most recently used first
+            EntryList entries;
+            std::unordered_map<RouteKey, EntryList::iterator, RouteKeyHash> index;
+            // searches being run, by the thread that asked first
+            std::unordered_map<RouteKey, std::shared_ptr<Flight>, RouteKeyHash> flights;
+            long bytes = 0;
+            long hits = 0;
+            long misses = 0;
+            long coalesced = 0;
+            long evictions = 0;
+            long invalidations = 0;
+            long carried = 0;
+        };
+
+        Shard shards[SHARDS];
+        std::atomic<long> capacity;
+        std::mutex editsMutex;
+        // the last edit that made each version, and the versions in the order they were made
+        std::unordered_map<unsigned long long, Edit> edits;
+        std::deque<unsigned long long> editOrder;
+
+        RouteCache() {
+            capacity = DEFAULT_CAPACITY;
+        }
+        Shard& shardOf(const RouteKey& key);
+        void evict(Shard& shard);
+        std::shared_ptr<const RouteEntry> findBeforeEdits(const RouteKey& key);
+};
+
+#endif
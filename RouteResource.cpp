@@ -0,0 +1,310 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: HTTP routing API for clients that do not use the web interface.
+*/
+
+#include "RouteResource.h"
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "AlgorithmFactory.h"
+#include "BuildingDictionary.h"
+#include "LogicServer.h"
+#include "WeightOverlay.h"
+
+namespace {
+  /**
+   * A board prepared for one map type with the overlay it was prepared with. Its graphs and version are
+   * computed before it is shared, so every server thread only reads it and keeps its search state in its own
+   * SearchWorkspace.
+  */
+  struct SharedRouteMap {
+    std::shared_ptr<const WeightOverlay> overlay;
+    Board board;
+  };
+
+  /**
+   * @brief Returns the prepared board of a map type, prepared again once a newer overlay was published.
+   * Requests that still hold the previous board finish their search on it.
+   * @param mapType, 0 for the classic map, 1 for the campus map.
+   * @return shared, the board with the latest overlay laid over it.
+  */
+  std::shared_ptr<SharedRouteMap> sharedMap(int mapType)
+  {
+    static std::shared_ptr<SharedRouteMap> maps[2];
+    static std::mutex preparing;
+    std::shared_ptr<const WeightOverlay> overlay = OverlayStore::getInstance().getOverlay(mapType);
+    std::shared_ptr<SharedRouteMap> shared = std::atomic_load(&maps[mapType]);
+    if(shared && shared->overlay == overlay) {
+      return shared;
+    }
+    std::lock_guard<std::mutex> lock(preparing);
+    // another thread may have prepared it while this one waited
+    shared = std::atomic_load(&maps[mapType]);
+    if(shared && shared->overlay == overlay) {
+      return shared;
+    }
+    std::shared_ptr<SharedRouteMap> prepared = std::make_shared<SharedRouteMap>();
+    prepared->overlay = overlay;
+    prepared->board.setBoardMapType(mapType);
+    LevelMap* map = prepared->board.getMap();
+    map->setOverlay(overlay);
+    map->getChains();
+    map->getVersion();
+    std::atomic_store(&maps[mapType], prepared);
+    return prepared;
+  }
+
+  /**
+   * @brief Returns a request parameter or a default.
+   * @param request, the HTTP request.
+   * @param name, the name of the parameter.
+   * @param fallback, the value used when the parameter is missing.
+   * @return value, the parameter.
+  */
+  std::string parameter(const Wt::Http::Request& request, const std::string& name, const std::string& fallback)
+  {
+    const std::string* value = request.getParameter(name);
+    return value ? *value : fallback;
+  }
+
+  /**
+   * @brief Appends an unsigned number in little-endian byte order.
+   * @param out, the buffer.
+   * @param value, the number.
+   * @param bytes, the width of the number in bytes.
+  */
+  void putLittleEndian(std::string& out, uint32_t value, int bytes)
+  {
+    for(int i = 0; i < bytes; i++) {
+      out.push_back((char) ((value >> (8 * i)) & 0xff));
+    }
+  }
+}
+
+RouteResource::~RouteResource()
+{
+  beingDeleted();
+}
+
+/**
+ * @brief Reads the starts or the targets of a request: cells as "row,col" or, on the campus map, building names,
+ * separated by ';'. A building stands for the cells of it given by the scope.
+ * @param text, the parameter value.
+ * @param mapType, 0 for the classic map, 1 for the campus map.
+ * @param scope, the cells of a building, see BuildingDictionary::appendBuildingCells.
+ * @param map, the map searched.
+ * @param cells, the cells the text names are added at its end.
+ * @return true if every part of the text names a cell or a building.
+*/
+bool RouteResource::parseEndpoints(const std::string& text, int mapType, int scope, const LevelMap& map, std::vector<std::pair<int, int>>& cells)
+{
+  std::istringstream parts(text);
+  std::string part;
+  size_t begin = cells.size();
+  while(std::getline(parts, part, ';')) {
+    size_t comma = part.find(',');
+    if(part.size() <= 11 && comma != std::string::npos && comma > 0 && comma + 1 < part.size()
+       && part.find_first_not_of("0123456789", 0) == comma && part.find_first_not_of("0123456789", comma + 1) == std::string::npos) {
+      cells.push_back(std::make_pair(std::stoi(part.substr(0, comma)), std::stoi(part.substr(comma + 1))));
+      continue;
+    }
+    const BuildingDictionary& dictionary = BuildingDictionary::getInstance();
+    int id = mapType == 1 ? dictionary.findBuilding(part) : -1;
+    if(id < 0) {
+      return false;
+    }
+    dictionary.appendBuildingCells(id, scope, map, cells);
+  }
+  return cells.size() > begin;
+}
+
+/**
+ * @brief Answers a request that cannot be routed.
+ * @param response, the HTTP response.
+ * @param message, what is wrong with the request.
+*/
+void RouteResource::sendError(Wt::Http::Response& response, const std::string& message)
+{
+  std::string body = "{\"error\":\"" + message + "\"}";
+  response.setStatus(400);
+  response.setMimeType("application/json");
+  response.setContentLength(body.size());
+  response.out() << body;
+}
+
+/**
+ * @brief Answers a request with several routes.
+ * @param response, the HTTP response.
+ * @param routes, the routes to the nearest targets or the alternative routes.
+ * @param expansions, the expansions of the search that found them.
+*/
+void RouteResource::sendRoutes(Wt::Http::Response& response, const std::vector<NearestRoute>& routes, long expansions)
+{
+  std::ostringstream json;
+  json << "{\"found\":" << (routes.empty() ? "false" : "true") << ",\"expansions\":" << expansions << ",\"routes\":[";
+  for(size_t i = 0; i < routes.size(); i++) {
+    const std::vector<std::pair<int, int>>& path = routes[i].path;
+    json << (i > 0 ? "," : "") << "{\"to\":" << routes[i].target << ",\"cost\":" << routes[i].cost << ",\"length\":" << path.size()
+         << ",\"path\":[";
+    for(size_t j = 0; j < path.size(); j++) {
+      json << (j > 0 ? "," : "") << path[j].first << "," << path[j].second;
+    }
+    json << "]}";
+  }
+  json << "]}";
+  std::string body = json.str();
+  response.setMimeType("application/json");
+  response.setContentLength(body.size());
+  response.out() << body;
+}
+
+/**
+ * @brief Finds the route of one request on the prepared board of its map type.
+ * @param request, the HTTP request with the parameters described in RouteResource.h.
+ * @param response, the HTTP response the route is written to.
+*/
+void RouteResource::handleRequest(const Wt::Http::Request& request, Wt::Http::Response& response)
+{
+  std::string mapName = parameter(request, "map", "campus");
+  int mapType;
+  if(mapName == "campus") {
+    mapType = 1;
+  } else if(mapName == "classic") {
+    mapType = 0;
+  } else {
+    sendError(response, "unknown map");
+    return;
+  }
+  int algorithmType = AlgorithmFactory::findAlgorithmType(parameter(request, "algorithm", "astar"));
+  if(algorithmType < 0) {
+    sendError(response, "unknown algorithm");
+    return;
+  }
+  std::string format = parameter(request, "format", "json");
+  if(format != "json" && format != "binary") {
+    sendError(response, "unknown format");
+    return;
+  }
+
+  // held until the answer is written, the board stays alive even if a newer overlay replaces it meanwhile
+  std::shared_ptr<SharedRouteMap> shared = sharedMap(mapType);
+  Board& board = shared->board;
+  const LevelMap* map = board.getMap();
+  std::string scopeName = parameter(request, "scope", "entrance");
+  int scope;
+  if(scopeName == "entrance") {
+    scope = BuildingDictionary::ENTRANCE;
+  } else if(scopeName == "entrances") {
+    scope = BuildingDictionary::ENTRANCES;
+  } else if(scopeName == "footprint") {
+    scope = BuildingDictionary::FOOTPRINT;
+  } else {
+    sendError(response, "unknown scope");
+    return;
+  }
+  const std::string* nearestText = request.getParameter("nearest");
+  int nearest = nearestText ? std::atoi(nearestText->c_str()) : 0;
+  if(nearestText && nearest < 1) {
+    sendError(response, "nearest must be a positive number");
+    return;
+  }
+  const std::string* alternativesText = request.getParameter("alternatives");
+  int alternatives = alternativesText ? std::atoi(alternativesText->c_str()) : 0;
+  if(alternativesText && alternatives < 1) {
+    sendError(response, "alternatives must be a positive number");
+    return;
+  }
+  if(nearestText && alternativesText) {
+    sendError(response, "nearest and alternatives cannot be combined");
+    return;
+  }
+  // every target of a nearest search is one cell, so a route names it by its position in to,
+  // and alternative routes are searched between two cells
+  if(nearestText || alternativesText) {
+    scope = BuildingDictionary::ENTRANCE;
+  }
+  std::vector<std::pair<int, int>> starts;
+  std::vector<std::pair<int, int>> targets;
+  if(!parseEndpoints(parameter(request, "from", ""), mapType, scope, *map, starts)
+     || !parseEndpoints(parameter(request, "to", ""), mapType, scope, *map, targets)) {
+    sendError(response, "from and to must be row,col or a building name");
+    return;
+  }
+  for(const std::vector<std::pair<int, int>>* cells: {&starts, &targets}) {
+    for(const std::pair<int, int>& cell: *cells) {
+      if(cell.first >= map->getRows() || cell.second >= map->getColumns() || map->getNode(cell.first, cell.second)->getType() == 5) {
+        sendError(response, "from and to must be open blocks on the map");
+        return;
+      }
+    }
+  }
+
+  LogicServer logicServer(&board);
+  logicServer.setMapShared(true);
+  logicServer.setAlgorithm(algorithmType, &board);
+  if(nearestText) {
+    if(format != "json") {
+      sendError(response, "nearest is answered in json only");
+      return;
+    }
+    if(starts.size() > 1) {
+      sendError(response, "nearest takes a single start");
+      return;
+    }
+    sendRoutes(response, logicServer.findNearest(starts[0], targets, nearest), logicServer.getLastStats().expansions);
+    return;
+  }
+  if(alternativesText) {
+    if(format != "json") {
+      sendError(response, "alternatives are answered in json only");
+      return;
+    }
+    if(starts.size() > 1 || targets.size() > 1) {
+      sendError(response, "alternatives take a single start and target");
+      return;
+    }
+    sendRoutes(response, logicServer.findAlternatives(starts[0], targets[0], alternatives), logicServer.getLastStats().expansions);
+    return;
+  }
+  // one search from every start at once, such as every door of a building; the start and target of the shared
+  // map are never set, a single pair is a set of one cell each
+  const std::vector<std::pair<int, int>>& path = logicServer.findRoute(starts, targets).second;
+  long expansions = logicServer.getLastStats().expansions;
+  long cost = 0;
+  for(size_t i = 1; i < path.size(); i++) {
+    cost += map->getWeight(path[i].first, path[i].second);
+  }
+
+  std::string body;
+  if(format == "binary") {
+    body.reserve(16 + 4 * path.size());
+    body += "NAVI";
+    putLittleEndian(body, path.size(), 4);
+    putLittleEndian(body, cost, 4);
+    putLittleEndian(body, expansions, 4);
+    for(const std::pair<int, int>& cell: path) {
+      putLittleEndian(body, cell.first, 2);
+      putLittleEndian(body, cell.second, 2);
+    }
+    response.setMimeType("application/octet-stream");
+  } else {
+    std::ostringstream json;
+    json << "{\"found\":" << (path.empty() ? "false" : "true") << ",\"cost\":" << cost << ",\"length\":" << path.size()
+         << ",\"expansions\":" << expansions << ",\"path\":[";
+    for(size_t i = 0; i < path.size(); i++) {
+      json << (i > 0 ? "," : "") << path[i].first << "," << path[i].second;
+    }
+    json << "]}";
+    body = json.str();
+    response.setMimeType("application/json");
+  }
+  // a known length lets the connection stay open for the next request
+  response.setContentLength(body.size());
+  response.out() << body;
+}
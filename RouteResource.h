@@ -0,0 +1,56 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: HTTP routing API for clients that do not use the web interface.
+*/
+
+#ifndef ROUTERESOURCE_H
+#define ROUTERESOURCE_H
+
+#include <Wt/WResource.h>
+#include <Wt/Http/Request.h>
+#include <Wt/Http/Response.h>
+#include <string>
+#include <utility>
+#include <vector>
+#include "LevelMap.h"
+#include "SearchWorkspace.h"
+
+/**
+* Stateless resource mounted at /api/route, shared by every client of the server.
+*
+* Parameters, as query string or form data:
+*   from, to:   cells as "row,col", or on the campus map building names of the BuildingDictionary,
+*               separated by ';'; the route found is the shortest from any start to any target,
+*               with one search from all the starts at once
+*   scope:      the cells a building stands for: entrance (default) for its recorded entrance,
+*               entrances for every door, footprint for every open cell on or next to it
+*   nearest:    route to each of the k nearest targets in to instead, from a single start;
+*               buildings stand for their entrance
+*   alternatives: the k shortest loopless routes between a single start and target instead,
+*               buildings stand for their entrance
+*   map:        campus (default) or classic
+*   algorithm:  astar (default) or dijkstra
+*   format:     json (default) or binary
+*
+* The JSON answer is {"found":true,"cost":c,"length":n,"expansions":e,"path":[row,col,row,col,...]}.
+* With nearest it is {"found":true,"expansions":e,"routes":[{"to":i,"cost":c,"length":n,"path":[...]},...]},
+* nearest first, where i is the position of the target in to. With alternatives it has the same form,
+* cheapest first and with i always 0. Both are answered in JSON only.
+* The binary answer is little-endian: the bytes "NAVI", uint32 length, uint32 cost, uint32 expansions,
+* then length pairs of uint16 row and uint16 column. Errors are answered with status 400 and
+* {"error":"..."} in JSON.
+*/
+class RouteResource : public Wt::WResource
+{
+public:
+    ~RouteResource();
+    void handleRequest(const Wt::Http::Request& request, Wt::Http::Response& response) override;
+
+private:
+    static bool parseEndpoints(const std::string& text, int mapType, int scope, const LevelMap& map, std::vector<std::pair<int, int>>& cells);
+    static void sendError(Wt::Http::Response& response, const std::string& message);
+    static void sendRoutes(Wt::Http::Response& response, const std::vector<NearestRoute>& routes, long expansions);
+};
+
+#endif
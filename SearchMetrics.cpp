@@ -0,0 +1,162 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: Process wide counters of the searches and sessions, exported by the /metrics resource.
+*/
+
+#include "SearchMetrics.h"
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+namespace {
+    // every shard ever created; shards are never freed, so counts of finished threads are kept
+    std::mutex shardsMutex;
+    std::vector<MetricsShard*> shards;
+
+    const char* MAP_NAMES[MetricsShard::MAP_TYPES] = {"classic", "campus", "custom"};
+
+    /**
+    * Adds to a counter of the calling thread's shard.
+    * @param counter: the counter, only ever written by this thread.
+    * @param amount: the amount to add.
+    */
+    void add(std::atomic<long>& counter, long amount) {
+        counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+
+    /**
+    * Sums one counter over all shards.
+    * @param counter: pointer to member selecting the counter.
+    * @return total: the sum.
+    */
+    long sum(std::atomic<long> MetricsShard::*counter) {
+        long total = 0;
+        for(MetricsShard* shard: shards) {
+            total += (shard->*counter).load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    /**
+    * Writes one counter family labelled by algorithm and map type.
+    * @param out: the stream to write to.
+    * @param name: the metric name.
+    * @param help: the description of the metric.
+    * @param counter: pointer to member selecting the counter array.
+    * @param scale: factor applied to the sums, to turn nanoseconds into seconds.
+    */
+    void writeFamily(std::ostream& out, const std::string& name, const std::string& help,
+                     std::atomic<long> (MetricsShard::*counter)[AlgorithmFactory::ALGORITHM_COUNT][MetricsShard::MAP_TYPES], double scale = 1) {
+        out << "# HELP " << name << " " << help << "\n";
+        out << "# TYPE " << name << " counter\n";
+        for(int type = 0; type < AlgorithmFactory::ALGORITHM_COUNT; type++) {
+            for(int map = 0; map < MetricsShard::MAP_TYPES; map++) {
+                long total = 0;
+                for(MetricsShard* shard: shards) {
+                    total += (shard->*counter)[type][map].load(std::memory_order_relaxed);
+                }
+                out << name << "{algorithm=\"" << AlgorithmFactory::getAlgorithmName(type) << "\",map=\"" << MAP_NAMES[map] << "\"} ";
+                if(scale == 1) {
+                    out << total << "\n";
+                } else {
+                    out << total * scale << "\n";
+                }
+            }
+        }
+    }
+
+    /**
+    * Writes one gauge.
+    * @param out: the stream to write to.
+    * @param name: the metric name.
+    * @param help: the description of the metric.
+    * @param value: the current value.
+    */
+    void writeGauge(std::ostream& out, const std::string& name, const std::string& help, long value) {
+        out << "# HELP " << name << " " << help << "\n";
+        out << "# TYPE " << name << " gauge\n";
+        out << name << " " << value << "\n";
+    }
+}
+
+/**
+* Returns the shard of the calling thread, creating it on first use. Only this first call takes a lock.
+* @return shard: the counters of the calling thread.
+*/
+MetricsShard& SearchMetrics::localShard() {
+    thread_local MetricsShard* shard = nullptr;
+    if(!shard) {
+        shard = new MetricsShard();
+        std::lock_guard<std::mutex> lock(shardsMutex);
+        shards.push_back(shard);
+    }
+    return *shard;
+}
+
+/**
+* Counts one finished search.
+* @param algorithmType: the algorithm of the factory that ran.
+* @param mapType: the map type of the board.
+* @param stats: the counters of the search.
+* @param elapsedNs: the wall time of the search in nanoseconds.
+*/
+void SearchMetrics::recordSearch(int algorithmType, int mapType, const SearchStats& stats, long elapsedNs) {
+    if(algorithmType < 0 || algorithmType >= AlgorithmFactory::ALGORITHM_COUNT || mapType < 0 || mapType >= MetricsShard::MAP_TYPES) {
+        return;
+    }
+    MetricsShard& shard = localShard();
+    add(shard.queries[algorithmType][mapType], 1);
+    add(shard.expansions[algorithmType][mapType], stats.expansions);
+    add(shard.heapPushes[algorithmType][mapType], stats.heapPushes);
+    add(shard.decreaseKeys[algorithmType][mapType], stats.decreaseKeys);
+    add(shard.searchNs[algorithmType][mapType], elapsedNs);
+}
+
+/**
+* Counts a new session, which holds no memory until it reports it with sessionResized.
+*/
+void SearchMetrics::sessionStarted() {
+    add(localShard().sessions, 1);
+}
+
+/**
+* Counts a change of the memory a session holds.
+* @param mapBytes: the bytes added to the maps of the session, negative when they shrank.
+* @param widgetBytes: the estimated bytes added to the widgets of the session.
+*/
+void SearchMetrics::sessionResized(long mapBytes, long widgetBytes) {
+    MetricsShard& shard = localShard();
+    add(shard.mapBytes, mapBytes);
+    add(shard.widgetBytes, widgetBytes);
+}
+
+/**
+* Counts a session that ended, with the sizes it reported last.
+* @param mapBytes: the bytes of the maps of the session.
+* @param widgetBytes: the estimated bytes of the widgets of the session.
+*/
+void SearchMetrics::sessionEnded(long mapBytes, long widgetBytes) {
+    MetricsShard& shard = localShard();
+    add(shard.sessions, -1);
+    add(shard.mapBytes, -mapBytes);
+    add(shard.widgetBytes, -widgetBytes);
+}
+
+/**
+* Sums the shards of all threads in the Prometheus text format.
+* @return text: the metrics page.
+*/
+std::string SearchMetrics::renderPrometheus() {
+    std::ostringstream out;
+    std::lock_guard<std::mutex> lock(shardsMutex);
+    writeFamily(out, "navi_queries_total", "Searches run.", &MetricsShard::queries);
+    writeFamily(out, "navi_expansions_total", "Blocks expanded by the searches.", &MetricsShard::expansions);
+    writeFamily(out, "navi_heap_pushes_total", "Pushes on the priority queue of the searches.", &MetricsShard::heapPushes);
+    writeFamily(out, "navi_decrease_keys_total", "Queued blocks that got a shorter distance and were pushed again.", &MetricsShard::decreaseKeys);
+    writeFamily(out, "navi_search_seconds_total", "Wall time spent in searches.", &MetricsShard::searchNs, 1e-9);
+    writeGauge(out, "navi_active_sessions", "Open browser sessions.", sum(&MetricsShard::sessions));
+    writeGauge(out, "navi_map_bytes", "Bytes of the maps held by the sessions.", sum(&MetricsShard::mapBytes));
+    writeGauge(out, "navi_widget_bytes", "Estimated bytes of the board widgets held by the sessions.", sum(&MetricsShard::widgetBytes));
+    return out.str();
+}
@@ -0,0 +1,48 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: Process wide counters of the searches and sessions, exported by the /metrics resource.
+*/
+
+#ifndef SEARCHMETRICS_H
+#define SEARCHMETRICS_H
+
+#include <atomic>
+#include <string>
+#include "Algorithm.h"
+#include "AlgorithmFactory.h"
+
+/**
+* Counters written by a single thread. Only the owning thread writes them, so an update is a plain
+* relaxed load and store without a lock or a locked instruction; readers only ever sum them.
+*/
+struct MetricsShard {
+    // number of map types: 0 classic, 1 campus, 2 custom
+    static const int MAP_TYPES = 3;
+
+    std::atomic<long> queries[AlgorithmFactory::ALGORITHM_COUNT][MAP_TYPES];
+    std::atomic<long> expansions[AlgorithmFactory::ALGORITHM_COUNT][MAP_TYPES];
+    std::atomic<long> heapPushes[AlgorithmFactory::ALGORITHM_COUNT][MAP_TYPES];
+    std::atomic<long> decreaseKeys[AlgorithmFactory::ALGORITHM_COUNT][MAP_TYPES];
+    std::atomic<long> searchNs[AlgorithmFactory::ALGORITHM_COUNT][MAP_TYPES];
+    // gauges, as changes made on this thread; a session may end on another thread than it started
+    std::atomic<long> sessions;
+    std::atomic<long> mapBytes;
+    std::atomic<long> widgetBytes;
+};
+
+/**
+* Records what the searches and sessions of the process do, in one shard per thread.
+*/
+class SearchMetrics {
+    public:
+        static void recordSearch(int algorithmType, int mapType, const SearchStats& stats, long elapsedNs);
+        static void sessionStarted();
+        static void sessionResized(long mapBytes, long widgetBytes);
+        static void sessionEnded(long mapBytes, long widgetBytes);
+        static std::string renderPrometheus();
+    private:
+        static MetricsShard& localShard();
+};
+
+#endif
@@ -0,0 +1,32 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: Per search state of the blocks of a map, kept apart from the blocks themselves.
+*/
+
+#include "SearchState.h"
+
+/**
+* Starts a new search: every block reads as unreached afterwards.
+* @param blocks: the number of blocks of the map searched.
+*/
+void SearchState::begin(int blocks) {
+    epoch += FLAGS + 1;
+    if(epoch == 0) {
+        // the stamp wrapped, so states written half a billion searches ago would look current again
+        states.assign(states.size(), BlockState());
+        epoch = FLAGS + 1;
+    }
+    if((int) states.size() < blocks) {
+        // new states get stamp 0, which no search uses
+        states.resize(blocks, BlockState());
+    }
+}
+
+/**
+* Bytes used by the state array.
+* @return bytes: the memory held for the states.
+*/
+long SearchState::getMemoryBytes() {
+    return sizeof(SearchState) + states.capacity() * sizeof(BlockState);
+}
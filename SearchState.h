@@ -0,0 +1,95 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: Per search state of the blocks of a map, kept apart from the blocks themselves.
+*/
+
+#ifndef SEARCHSTATE_H
+#define SEARCHSTATE_H
+
+#include <vector>
+
+/**
+* What one search knows about a node of the graph it searches, 12 bytes per node.
+*/
+struct BlockState {
+    // distance from the start, the g cost for A*
+    int cost;
+    // how the cost was reached, as recorded by the algorithm, -1 for the start
+    int prev;
+    // the search the state belongs to, shifted left by three, with the VISITED, QUEUED and TARGET flags below
+    unsigned int mark;
+};
+
+/**
+* The state of every node of the graph searched for the search that is running, indexed by node.
+* Starting a search does not touch the array: every state is stamped with the search it was written by,
+* and a state with an older stamp reads as unreached. The array is only cleared when the stamp wraps.
+*/
+class SearchState {
+    public:
+        // the cost of a block that no search reached yet
+        static const int UNREACHED = 100000;
+
+        void begin(int blocks);
+        long getMemoryBytes();
+
+        int getCost(int block) const {
+            return current(block) ? states[block].cost : UNREACHED;
+        }
+        int getPrev(int block) const {
+            return current(block) ? states[block].prev : -1;
+        }
+        bool visited(int block) const {
+            return current(block) && (states[block].mark & VISITED);
+        }
+        bool isInQueue(int block) const {
+            return current(block) && (states[block].mark & QUEUED);
+        }
+        bool isTarget(int block) const {
+            return current(block) && (states[block].mark & TARGET);
+        }
+        /**
+        * Marks a block as one the search looks for, before the search reaches it.
+        * @param block: the block.
+        */
+        void setTarget(int block) {
+            BlockState& state = states[block];
+            if(!current(block)) {
+                state.cost = UNREACHED;
+                state.prev = -1;
+                state.mark = epoch;
+            }
+            state.mark |= TARGET;
+        }
+        /**
+        * Records a cheaper way to a block and marks it as queued.
+        * @param block: the block.
+        * @param cost: the cost of the new way.
+        * @param prev: how the node was reached, -1 for the start.
+        */
+        void reach(int block, int cost, int prev) {
+            BlockState& state = states[block];
+            state.mark = current(block) ? state.mark | QUEUED : epoch | QUEUED;
+            state.cost = cost;
+            state.prev = prev;
+        }
+        void setVisit(int block) {
+            states[block].mark |= VISITED;
+        }
+    private:
+        static const unsigned int VISITED = 1;
+        static const unsigned int QUEUED = 2;
+        static const unsigned int TARGET = 4;
+        static const unsigned int FLAGS = VISITED | QUEUED | TARGET;
+
+        std::vector<BlockState> states;
+        // stamp of the running search, a multiple of 8
+        unsigned int epoch = 0;
+
+        bool current(int block) const {
+            return (states[block].mark & ~FLAGS) == epoch;
+        }
+};
+
+#endif
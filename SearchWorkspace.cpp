@@ -0,0 +1,52 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: Buffers of the searches run by one thread, reserved once and reused by every query.
+*/
+
+#include "SearchWorkspace.h"
+
+/**
+* Returns the workspace of the calling thread, created on its first search.
+* @return workspace: the workspace.
+*/
+SearchWorkspace& SearchWorkspace::local() {
+    thread_local SearchWorkspace workspace;
+    return workspace;
+}
+
+/**
+* Starts a new search: no block is reached, the frontier and the result are empty.
+* @param blocks: the number of blocks of the map searched.
+*/
+void SearchWorkspace::begin(int blocks) {
+    state.begin(blocks);
+    frontier.clear();
+    reached.clear();
+    result.first.clear();
+    result.second.clear();
+    routes.clear();
+}
+
+/**
+* Bytes held by the workspace.
+* @return bytes: the memory of the state, the frontier, the query and the result.
+*/
+long SearchWorkspace::getMemoryBytes() {
+    return sizeof(SearchWorkspace) - sizeof(SearchState) + state.getMemoryBytes() + frontier.capacity() * sizeof(FrontierEntry)
+        + (query.startNodes.capacity() + query.targetNodes.capacity() + query.starts.capacity() + query.targets.capacity()
+           + reached.capacity() + startCosts.capacity() + pathPositions.capacity() + blockedLinks.capacity()) * sizeof(int) + query.ends.capacity() * sizeof(ChainEnd)
+        + (result.first.capacity() + result.second.capacity()) * sizeof(std::pair<int, int>) + getPathBytes();
+}
+
+/**
+* Bytes held by the routes kept for alternative routes searches.
+* @return bytes: the memory of the routes.
+*/
+long SearchWorkspace::getPathBytes() {
+    long bytes = paths.capacity() * sizeof(ChainPath);
+    for(const ChainPath& path: paths) {
+        bytes += (path.nodes.capacity() + path.links.capacity() + path.costs.capacity()) * sizeof(int);
+    }
+    return bytes;
+}
@@ -0,0 +1,93 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: Buffers of the searches run by one thread, reserved once and reused by every query.
+*/
+
+#ifndef SEARCHWORKSPACE_H
+#define SEARCHWORKSPACE_H
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include "ChainGraph.h"
+#include "SearchState.h"
+
+/**
+* A queued block with the costs it had when it was queued.
+* A block whose cost drops is queued again, the outdated entry is skipped when popped.
+*/
+struct FrontierEntry {
+    // the distance from the start for Dijkstra, f_cost = g_cost + h_cost for A*
+    int cost;
+    // the h_cost for A*, 0 for Dijkstra
+    int tieBreak;
+    // the node of the graph searched
+    int block;
+};
+
+/**
+* One of the targets found by a search for the nearest of several targets.
+*/
+struct NearestRoute {
+    // the index of the target in the list searched for
+    int target;
+    // the weight of every block entered after the start
+    int cost;
+    std::vector<std::pair<int, int>> path;
+};
+
+/**
+* A route over the search nodes of a ChainGraph, found by AlternativeRoutes from the target to the start.
+*/
+struct ChainPath {
+    // links[i] leads from nodes[i - 1] to nodes[i], links[0] is -1
+    std::vector<int> nodes;
+    std::vector<int> links;
+    // the cost of the route up to each of its nodes
+    std::vector<int> costs;
+};
+
+/**
+* Everything a search needs besides the map: the state of the blocks, the frontier and the result.
+* Every thread has one workspace, used by every algorithm it runs. Its vectors are cleared but never
+* shrunk, so once a thread ran a query as large as the next one, the next one allocates nothing.
+* The result stays valid until the thread starts its next search.
+*/
+struct SearchWorkspace {
+    SearchState state;
+    // binary heap, ordered by the comparison of the algorithm that fills it
+    std::vector<FrontierEntry> frontier;
+    // the starts and targets of the search
+    ChainQuery query;
+    // the search nodes of the targets found, nearest first
+    std::vector<int> reached;
+    // the visited blocks in the order they were expanded, and the path from the start to the target
+    std::pair<std::vector<std::pair<int, int>>, std::vector<std::pair<int, int>>> result;
+    // the routes of a search for the nearest of several targets, or for alternative routes
+    std::vector<NearestRoute> routes;
+    // for alternative routes: the cost from the start of every search node, its position on the last route
+    // found or -1, and the routes found
+    std::vector<int> startCosts;
+    std::vector<int> pathPositions;
+    std::vector<ChainPath> paths;
+    std::vector<int> blockedLinks;
+
+    static SearchWorkspace& local();
+    void begin(int blocks);
+    long getMemoryBytes();
+    long getPathBytes();
+
+    template<class Compare> void push(const FrontierEntry& entry) {
+        frontier.push_back(entry);
+        std::push_heap(frontier.begin(), frontier.end(), Compare());
+    }
+    template<class Compare> FrontierEntry pop() {
+        std::pop_heap(frontier.begin(), frontier.end(), Compare());
+        FrontierEntry entry = frontier.back();
+        frontier.pop_back();
+        return entry;
+    }
+};
+
+#endif
@@ -0,0 +1,95 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: A read-only table of a graph, either built and owned or mapped from a snapshot file.
+*/
+
+#ifndef TABLEVIEW_H
+#define TABLEVIEW_H
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+/**
+* The values of one table of a GraphView or ChainGraph. A built table owns its values: they are filled
+* through owned() and then used with useOwned(). A mapped table points into a MapSnapshot, which is
+* shared by every map and process that opened the same file, and is never written.
+*/
+template <typename T>
+class TableView {
+    public:
+        TableView() = default;
+        TableView(const TableView& other) : values(other.values) {
+            point(other);
+        }
+        TableView& operator=(const TableView& other) {
+            values = other.values;
+            point(other);
+            return *this;
+        }
+        // a move takes the owned values without copying them, or the same mapped values
+        TableView(TableView&& other) noexcept {
+            take(other);
+        }
+        TableView& operator=(TableView&& other) noexcept {
+            take(other);
+            return *this;
+        }
+
+        // the values owned by the table, filled before useOwned is called
+        std::vector<T>& owned() {
+            return values;
+        }
+        void useOwned() {
+            first = values.data();
+            count = values.size();
+        }
+        void useMapped(const T* data, std::size_t size) {
+            values.clear();
+            first = data;
+            count = size;
+        }
+        bool isMapped() const {
+            return count > 0 && first != values.data();
+        }
+        // memory the table holds itself, none while it is mapped
+        long getOwnedBytes() const {
+            return values.capacity() * sizeof(T);
+        }
+
+        const T& operator[](std::size_t index) const {
+            return first[index];
+        }
+        std::size_t size() const {
+            return count;
+        }
+        const T* begin() const {
+            return first;
+        }
+        const T* end() const {
+            return first + count;
+        }
+    private:
+        std::vector<T> values;
+        const T* first = nullptr;
+        std::size_t count = 0;
+
+        // after values were copied from other: the copy, or the same mapped values
+        void point(const TableView& other) {
+            first = other.isMapped() ? other.first : values.data();
+            count = other.count;
+        }
+        // moves the values of other, which is left empty
+        void take(TableView& other) {
+            bool mapped = other.isMapped();
+            values = std::move(other.values);
+            first = mapped ? other.first : values.data();
+            count = other.count;
+            other.values.clear();
+            other.first = nullptr;
+            other.count = 0;
+        }
+};
+
+#endif
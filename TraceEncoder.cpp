@@ -0,0 +1,31 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: To pack a list of visited cells into a compact payload for the browser.
+*/
+
+#include "TraceEncoder.h"
+
+/**
+* Encode the cells as a delta-encoded JavaScript array literal.
+* @param cells: the cells in order.
+* @param columns: the number of columns of the map.
+* @return payload: the array literal, e.g. "[532,1,52,-1]".
+*/
+std::string TraceEncoder::encode(const std::vector<std::pair<int, int>>& cells, int columns)
+{
+    std::string payload;
+    payload.reserve(cells.size() * 3 + 2);
+    payload += '[';
+    int previous = 0;
+    for(size_t i = 0; i < cells.size(); i++) {
+        int index = cells[i].first * columns + cells[i].second;
+        if(i > 0) {
+            payload += ',';
+        }
+        payload += std::to_string(index - previous);
+        previous = index;
+    }
+    payload += ']';
+    return payload;
+}
@@ -0,0 +1,24 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: To pack a list of visited cells into a compact payload for the browser.
+*/
+#ifndef TRACEENCODER_H
+#define TRACEENCODER_H
+
+#include <string>
+#include <vector>
+
+/**
+* Encodes a search trace as a JavaScript array of delta-encoded cell indexes.
+* Each cell becomes its index row * columns + col, and every entry after the first is
+* the difference from the previous index. Search traces move between neighbouring cells,
+* so most entries are one or two characters long.
+*/
+class TraceEncoder
+{
+    public:
+        static std::string encode(const std::vector<std::pair<int, int>>& cells, int columns);
+};
+
+#endif
@@ -0,0 +1,84 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: Versioned weight changes and closed blocks laid over the maps, shared by every session and thread.
+*/
+
+#include "WeightOverlay.h"
+#include <algorithm>
+#include <atomic>
+#include <utility>
+
+/**
+* Finds the weight the overlay gives a block.
+* @param row: the row of the block.
+* @param col: the column of the block.
+* @return weight: the weight laid over the block, GraphView::CLOSED if it is closed, -1 if it is not changed.
+*/
+int WeightOverlay::findWeight(int row, int col) const {
+    auto found = std::lower_bound(changes.begin(), changes.end(), std::make_pair(row, col), [](const OverlayChange& change, const std::pair<int, int>& block) {
+        return change.row < block.first || (change.row == block.first && change.col < block.second);
+    });
+    if(found == changes.end() || found->row != row || found->col != col) {
+        return -1;
+    }
+    return found->weight;
+}
+
+/**
+* Returns the store shared by the whole process.
+* @return store: the overlays of every map type.
+*/
+OverlayStore& OverlayStore::getInstance() {
+    static OverlayStore store;
+    return store;
+}
+
+/**
+* Returns the current overlay of a map type without waiting for a publish in progress.
+* @param mapType: the type of the map, see Board.
+* @return overlay: the newest overlay, null if none was published for the map type.
+*/
+std::shared_ptr<const WeightOverlay> OverlayStore::getOverlay(int mapType) const {
+    if(mapType < 0 || mapType >= MAP_TYPES) {
+        return nullptr;
+    }
+    return std::atomic_load(&overlays[mapType]);
+}
+
+/**
+* Replaces the overlay of a map type. Changes of the same block keep the last one, changes with a weight
+* outside 0 to 255 or a negative row or column are dropped. Searches running on the previous overlay finish on it.
+* @param mapType: the type of the map, see Board.
+* @param changes: every block the new overlay changes, an empty list takes all changes back.
+* @return overlay: the overlay published, null if the map type is unknown.
+*/
+std::shared_ptr<const WeightOverlay> OverlayStore::publish(int mapType, std::vector<OverlayChange> changes) {
+    if(mapType < 0 || mapType >= MAP_TYPES) {
+        return nullptr;
+    }
+    changes.erase(std::remove_if(changes.begin(), changes.end(), [](const OverlayChange& change) {
+        return change.weight < 0 || change.weight > 255 || change.row < 0 || change.col < 0;
+    }), changes.end());
+    std::stable_sort(changes.begin(), changes.end(), [](const OverlayChange& a, const OverlayChange& b) {
+        return a.row < b.row || (a.row == b.row && a.col < b.col);
+    });
+    // the last change of a block is the one kept
+    std::vector<OverlayChange> kept;
+    for(const OverlayChange& change: changes) {
+        if(!kept.empty() && kept.back().row == change.row && kept.back().col == change.col) {
+            kept.back() = change;
+        } else {
+            kept.push_back(change);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(publishing);
+    std::shared_ptr<WeightOverlay> overlay = std::make_shared<WeightOverlay>();
+    std::shared_ptr<const WeightOverlay> previous = std::atomic_load(&overlays[mapType]);
+    overlay->version = previous ? previous->version + 1 : 1;
+    overlay->changes = std::move(kept);
+    std::shared_ptr<const WeightOverlay> published = overlay;
+    std::atomic_store(&overlays[mapType], published);
+    return published;
+}
@@ -0,0 +1,63 @@
+/**
+* Authors: Alysha Aul, Nandhitha Krishnan, Paul Rodgers, Nouran Sakr, Chun Yang
+* Date: November 28, 2023
+* Purpose: Versioned weight changes and closed blocks laid over the maps, shared by every session and thread.
+*/
+
+#ifndef WEIGHTOVERLAY_H
+#define WEIGHTOVERLAY_H
+
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "GraphView.h"
+
+/**
+* A block whose weight an overlay changes: the new weight, or GraphView::CLOSED when the block cannot be
+* entered, such as a corridor or entrance closed for the day.
+*/
+struct OverlayChange {
+    int row;
+    int col;
+    int weight;
+};
+
+/**
+* The weights laid over one map type, never changed after it is published, so a search that took it sees
+* the same weights until it ends while newer versions are published.
+*/
+struct WeightOverlay {
+    // 1 for the first overlay published for a map type, one more for every later one
+    unsigned long long version;
+    // sorted by row and column, one change per block
+    std::vector<OverlayChange> changes;
+
+    int findWeight(int row, int col) const;
+};
+
+/**
+* Process wide store of the current overlay of every map type. Publishing replaces the whole overlay with
+* a new version; boards switch to it before their next search, see LevelMap::setOverlay, which takes one
+* pass over the blocks and never builds the graphs of the map again.
+*/
+class OverlayStore {
+    public:
+        // the map types of Board
+        static const int MAP_TYPES = 3;
+
+        static OverlayStore& getInstance();
+        OverlayStore(const OverlayStore&) = delete;
+        OverlayStore& operator=(const OverlayStore&) = delete;
+
+        std::shared_ptr<const WeightOverlay> getOverlay(int mapType) const;
+        std::shared_ptr<const WeightOverlay> publish(int mapType, std::vector<OverlayChange> changes);
+    private:
+        OverlayStore() = default;
+
+        // orders the versions of every map type
+        std::mutex publishing;
+        // null until the first overlay of a map type is published
+        std::shared_ptr<const WeightOverlay> overlays[MAP_TYPES];
+};
+
+#endif
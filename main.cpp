@@ -5,7 +5,17 @@
  */
 
 #include <Wt/WApplication.h>
+#include <Wt/WServer.h>
+#include <cstdlib>
+#include <iostream>
+#include "AdminToken.h"
 #include "Interface.h"
+#include "MapSnapshot.h"
+#include "MemoryLedger.h"
+#include "MemoryResource.h"
+#include "MetricsResource.h"
+#include "OverlayResource.h"
+#include "RouteResource.h"
 
 int main(int argc, char **argv)
 {
@@ -14,17 +24,57 @@ int main(int argc, char **argv)
    * start the server application (FastCGI or httpd) that starts listening
    * for requests, and handles all of the application life cycles.
    *
-   * The last argument to WRun specifies the function that will instantiate
-   * new application objects. That function is executed when a new user surfs
+   * The entry point specifies the function that will instantiate new
+   * application objects. That function is executed when a new user surfs
    * to the Wt application, and after the library has negotiated browser
    * support. The function should return a newly instantiated application
    * object.
+   *
+   * Next to the application, the server serves the counters of all sessions
+   * at /metrics for monitoring, routes for kiosks and mobile apps at
+   * /api/route without a session, the closures of the day at /api/overlay, and the
+   * memory of every session at /admin/memory. Publishing closures and reading the
+   * memory take the token of the administrators, NAVI_ADMIN_TOKEN.
+   *
+   * The graph tables of the built-in maps are mapped from a snapshot file, NAVI_SNAPSHOT
+   * or naviNode.tables in the working directory, shared by every naviNode process
+   * that runs from it. The first process to start writes it.
    */
-  return Wt::WRun(argc, argv, [](const Wt::WEnvironment &env) {
-    /*
-     * You could read information from the environment to decide whether
-     * the user has permission to start a new application
-     */
-    return std::make_unique<Interface>(env);
-  });
+  const char* snapshotPath = std::getenv("NAVI_SNAPSHOT");
+  if(!MapSnapshot::prepare(snapshotPath ? snapshotPath : "naviNode.tables")) {
+    std::cerr << "cannot read or write the map snapshot, every session builds its own tables" << std::endl;
+  }
+  // a session holding more than NAVI_SESSION_BUDGET_KB is reported in the log, 0 reports none
+  const char* budget = std::getenv("NAVI_SESSION_BUDGET_KB");
+  if(budget) {
+    MemoryLedger::getInstance().setBudget(std::atol(budget) * 1024);
+  }
+  // without a token no overlay can be published and no memory read
+  const char* adminToken = std::getenv("NAVI_ADMIN_TOKEN");
+  if(adminToken) {
+    AdminToken::setToken(adminToken);
+  }
+  try {
+    Wt::WServer server(argc, argv, WTHTTP_CONFIGURATION);
+    MetricsResource metrics;
+    server.addResource(&metrics, "/metrics");
+    RouteResource routes;
+    server.addResource(&routes, "/api/route");
+    OverlayResource overlays;
+    server.addResource(&overlays, "/api/overlay");
+    MemoryResource memory;
+    server.addResource(&memory, "/admin/memory");
+    server.addEntryPoint(Wt::EntryPointType::Application, [](const Wt::WEnvironment &env) {
+      /*
+       * You could read information from the environment to decide whether
+       * the user has permission to start a new application
+       */
+      return std::make_unique<Interface>(env);
+    });
+    server.run();
+  } catch (Wt::WServerException& e) {
+    std::cerr << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
 }